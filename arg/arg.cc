@@ -108,7 +108,11 @@ Arg::Arg(int argc, char *argv[])
   d_searchpage(false),
   d_findrecipient(-1),
   d_importtelegram(std::string()),
-  d_mapjsoncontacts(std::vector<std::pair<std::string, long long int>>())
+  d_mapjsoncontacts(std::vector<std::pair<std::string, long long int>>()),
+  d_jobs(1),
+  d_dbondisk(false),
+  d_dbondiskthreshold(0),
+  d_integritycheck("quick")
 {
   // vector to hold arguments
   std::vector<std::string> config;
@@ -1171,6 +1175,63 @@ bool Arg::parseArgs(std::vector<std::string> const &arguments)
       }
       continue;
     }
+    if (option == "--jobs")
+    {
+      if (i < arguments.size() - 1)
+      {
+        if (!ston(&d_jobs, arguments[++i]))
+        {
+          std::cerr << "[ Error parsing command line option `" << option << "': Bad argument. ]" << std::endl;
+          ok = false;
+        }
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
+    if (option == "--dbondisk")
+    {
+      d_dbondisk = true;
+      continue;
+    }
+    if (option == "--no-dbondisk")
+    {
+      d_dbondisk = false;
+      continue;
+    }
+    if (option == "--integritycheck")
+    {
+      if (i < arguments.size() - 1)
+      {
+        d_integritycheck = arguments[++i];
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
+    if (option == "--dbondiskthreshold")
+    {
+      if (i < arguments.size() - 1)
+      {
+        if (!ston(&d_dbondiskthreshold, arguments[++i]))
+        {
+          std::cerr << "[ Error parsing command line option `" << option << "': Bad argument. ]" << std::endl;
+          ok = false;
+        }
+      }
+      else
+      {
+        std::cerr << "[ Error parsing command line option `" << option << "': Missing argument. ]" << std::endl;
+        ok = false;
+      }
+      continue;
+    }
     if (option[0] != '-')
     {
       if (d_positionals >= 2)
@@ -49,6 +49,13 @@ changes, you must provide one of the output options.
 --runsqlquery <QUERY>          Run <QUERY> against the backup's internal SQL database.
 --runprettysqlquery <QUERY>    As above, but try show output in a pretty table. If the output is not too
                                large for your terminal, this is often much more readable.
+--dbondisk                     Keep the backup's SQL database in a temporary file instead of in memory.
+                               Note this writes the decrypted messages to the system's temporary directory.
+   --dbondiskthreshold <MB>    Optional modifier. Only use the temporary file when <INPUT> is larger than
+                               MB megabytes (for a backup file, this size includes the attachments).
+--integritycheck <LEVEL>       Set the check done on the database after opening <INPUT>. LEVEL is one of
+                               `none', `foreignkeys', `quick' (default) or `full'. A passed check is
+                               remembered for the input, so opening it again skips the check.
 
  = OUTPUT OPTIONS =
 -o, --output <OUTPUT>                    Either a file or a directory. When output is a file, this will
@@ -107,6 +114,8 @@ R"*(
                                          to switch the theme between light and dark. This adds a bit of
                                          javascript to the page, and sets a cookie when switching.
    --includecalllog                      Optional modifier for `--exporthtml'. Generate a call log-page.
+   --jobs [N]                            Optional modifier for `--exporthtml' and `--dumpmedia'. Write up to
+                                         N threads (or attachments) at the same time (default: 1).
 --exportcsv <MAP_OF_FILES>               Export the database to file of comma separated values. Argument:
                                          "tablename1=filename1,tablename2=filename2(,...)"
 --exporttxt <DIRECTORY>                  Export the messages to plain text file. Attachments are omitted.
@@ -275,8 +275,7 @@ inline void AttachmentFrame::setLengthField(uint32_t newlength)
     if (std::get<0>(p) == FIELD::LENGTH)
     {
       // out with the old
-      if (std::get<1>(p))
-        delete[] std::get<1>(p);
+      deleteFieldData(std::get<1>(p));
 
       // in with the new
       uint32_t tmp = bepaald::swap_endian(newlength);
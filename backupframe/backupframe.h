@@ -24,6 +24,8 @@
 #include <cstddef>
 #include <vector>
 #include <tuple>
+#include <memory>
+#include <functional>
 #include <unordered_map>
 #include <limits>
 
@@ -73,6 +75,11 @@ class BackupFrame
   std::vector<std::tuple<unsigned int, unsigned char *, uint64_t>> d_framedata; // field number, field data, length
   uint64_t d_count;
   size_t d_constructedsize;
+  // the parsed fields of a frame point into this single buffer (a copy of the frame data, followed by
+  // the decoded varints), instead of each owning its own allocation. Fields that were added or changed
+  // later still own their data, see deleteFieldData().
+  std::unique_ptr<unsigned char[]> d_arena;
+  size_t d_arena_size;
  public:
   explicit inline BackupFrame(uint64_t count);
   inline BackupFrame(unsigned char *data, size_t length, uint64_t count);
@@ -102,7 +109,11 @@ class BackupFrame
   inline uint64_t bytesToUint64(unsigned char *data, size_t len) const;
   inline int32_t bytesToInt32(unsigned char *data, size_t len) const;
   inline int64_t bytesToInt64(unsigned char *data, size_t len) const;
-  bool init(unsigned char *data, size_t length, std::vector<std::tuple<unsigned int, unsigned char *, uint64_t>> *framedata);
+  static bool scanFields(unsigned char *data, size_t length, size_t *fields, size_t *varints);
+  bool init(unsigned char *data, size_t length, std::vector<std::tuple<unsigned int, unsigned char *, uint64_t>> *framedata,
+            unsigned char **varints);
+  inline static bool inBuffer(unsigned char const *p, unsigned char const *buffer, size_t size);
+  inline void deleteFieldData(unsigned char *data) const;
   template <typename T>
   inline void intTypeToBytes(T val, unsigned char *b);
   inline uint64_t putVarInt(uint64_t val, unsigned char *mem) const;
@@ -128,19 +139,31 @@ inline BackupFrame::BackupFrame(uint64_t num)
   :
   d_ok(false),
   d_count(num),
-  d_constructedsize(0)
+  d_constructedsize(0),
+  d_arena_size(0)
 {}
 
 inline BackupFrame::BackupFrame(unsigned char *data, size_t l, uint64_t num)
   :
   d_ok(false),
   d_count(num),
-  d_constructedsize(l)
+  d_constructedsize(l),
+  d_arena_size(0)
 {
   //std::cout << "CREATING BACKUPFRAME!" << std::endl;
   DEBUGOUT("CREATING BACKUPFRAME!");
   DEBUGOUT("DATA: ", bepaald::bytesToHexString(data, l), " (", l, " bytes)");
-  d_ok = init(data, l, &d_framedata);
+  size_t fields = 0;
+  size_t varints = 0;
+  if (!scanFields(data, l, &fields, &varints)) [[unlikely]]
+    return;
+
+  d_arena_size = l + varints * sizeof(uint64_t);
+  d_arena.reset(new unsigned char[d_arena_size]);
+  std::memcpy(d_arena.get(), data, l);
+  unsigned char *varintdata = d_arena.get() + l;
+  d_framedata.reserve(fields);
+  d_ok = init(d_arena.get(), l, &d_framedata, &varintdata);
 }
 
 inline BackupFrame::BackupFrame(BackupFrame &&other)
@@ -148,9 +171,12 @@ inline BackupFrame::BackupFrame(BackupFrame &&other)
   d_ok(std::move(other.d_ok)),
   d_framedata(std::move(other.d_framedata)),
   d_count(std::move(other.d_count)),
-  d_constructedsize(std::move(other.d_constructedsize))
+  d_constructedsize(std::move(other.d_constructedsize)),
+  d_arena(std::move(other.d_arena)),
+  d_arena_size(std::move(other.d_arena_size))
 {
   other.d_framedata.clear(); // clear other without delete[]ing, ~this will do it
+  other.d_arena_size = 0;
 }
 
 inline BackupFrame &BackupFrame::operator=(BackupFrame &&other)
@@ -159,8 +185,7 @@ inline BackupFrame &BackupFrame::operator=(BackupFrame &&other)
   {
     // properly delete any data this is holding
     for (uint i = 0; i < d_framedata.size(); ++i)
-      if (std::get<1>(d_framedata[i]))
-        delete[] std::get<1>(d_framedata[i]);
+      deleteFieldData(std::get<1>(d_framedata[i]));
     d_framedata.clear();
 
     d_ok = std::move(other.d_ok);
@@ -168,11 +193,17 @@ inline BackupFrame &BackupFrame::operator=(BackupFrame &&other)
     other.d_framedata.clear();
     d_count = std::move(other.d_count);
     d_constructedsize = std::move(other.d_constructedsize);
+    d_arena = std::move(other.d_arena);
+    d_arena_size = other.d_arena_size;
+    other.d_arena_size = 0;
   }
   return *this;
 }
 
+// a copy owns all its field data individually
 inline BackupFrame::BackupFrame(BackupFrame const &other)
+  :
+  d_arena_size(0)
 {
   d_ok = other.d_ok;
   d_count = other.d_count;
@@ -214,11 +245,24 @@ inline BackupFrame::~BackupFrame()
 {
   //std::cout << "DESTROYING BACKUPFRAME!" << std::endl;
   for (uint i = 0; i < d_framedata.size(); ++i)
-    if (std::get<1>(d_framedata[i]))
-      delete[] std::get<1>(d_framedata[i]);
+    deleteFieldData(std::get<1>(d_framedata[i]));
   d_framedata.clear();
 }
 
+inline bool BackupFrame::inBuffer(unsigned char const *p, unsigned char const *buffer, size_t size) // static
+{
+  // std::less gives a total order, also for pointers into different objects. The end is included,
+  // a (zero-length) field may point one past the buffer's last byte
+  return buffer && !std::less<unsigned char const *>()(p, buffer) && !std::less<unsigned char const *>()(buffer + size, p);
+}
+
+// frees field data, unless it lives in d_arena
+inline void BackupFrame::deleteFieldData(unsigned char *data) const
+{
+  if (data && !inBuffer(data, d_arena.get(), d_arena_size))
+    delete[] data;
+}
+
 inline bool BackupFrame::ok()
 {
   return d_ok;
@@ -19,7 +19,71 @@
 
 #include "backupframe.ih"
 
-bool BackupFrame::init(unsigned char *data, size_t l, std::vector<std::tuple<unsigned int, unsigned char *, uint64_t>> *framedata)
+/*
+  Checks the fields in data, and counts how many of them init() will store (in 'fields'), and
+  how many of those are varints (in 'varints'), so storage for them can be allocated up front.
+*/
+bool BackupFrame::scanFields(unsigned char *data, size_t l, size_t *fields, size_t *varints) // static
+{
+  unsigned int processed = 0;
+  while (processed < l)
+  {
+    if (getFieldnumber(data[processed]) < 0)
+      return false;
+    uint32_t type = wiretype(data[processed]);
+    ++processed; // first byte was eaten
+
+    switch (type)
+    {
+      case LENGTHDELIM:
+      {
+        int64_t length = getLength(data, &processed, l);
+        if (length < 0 || processed + static_cast<uint64_t>(length) > l) [[unlikely]] // more then we have
+          return false;
+        processed += length;
+        ++(*fields);
+        break;
+      }
+      case VARINT:
+      {
+        int64_t val = getVarint(data, &processed, l);
+        if (val == -1 &&                           // (possible?) invalid value
+            processed == l &&                      // last byte was processed
+            data[l - 1] & 0b10000000) [[unlikely]] // but last byte was not end of varint
+          return false;
+        ++(*fields);
+        ++(*varints);
+        break;
+      }
+      case FIXED32:
+      {
+        if (processed + 4 > l) // more then we have
+          return false;
+        processed += 4;
+        break;
+      }
+      case FIXED64:
+      {
+        if (processed + 8 > l) // more then we have
+          return false;
+        processed += 8;
+        ++(*fields);
+        break;
+      }
+      // STARTTYPE and ENDTYPE have no data
+    }
+  }
+  return (processed == l);
+}
+
+/*
+  Parses the fields in data into framedata. The field data is not copied: length-delimited and
+  fixed64 fields point into 'data' (which must outlive framedata, empty fields point at its start),
+  varints are (byte-swapped) written to *varints, which is advanced past them (it needs 8 bytes for
+  every varint counted by scanFields()).
+*/
+bool BackupFrame::init(unsigned char *data, size_t l, std::vector<std::tuple<unsigned int, unsigned char *, uint64_t>> *framedata,
+                       unsigned char **varints)
 {
 
   //std::cout << "INITIALIZING FRAME OF " << l << " BYTES" << std::endl;
@@ -44,11 +108,11 @@ bool BackupFrame::init(unsigned char *data, size_t l, std::vector<std::tuple<uns
         int64_t length = getLength(data, &processed, l);
         if (length < 0 || processed + static_cast<uint64_t>(length) > l) [[unlikely]] // more then we have
           return false;
-        unsigned char *fielddata = new unsigned char[length];
-        std::memcpy(fielddata, data + processed, length);
         //DEBUGOUT("FIELDNUMB: ", fieldnumber);
-        //DEBUGOUT("FIELDDATA: ", bepaald::bytesToHexString(fielddata, length));
-        framedata->push_back(std::make_tuple(fieldnumber, fielddata, length));
+        //DEBUGOUT("FIELDDATA: ", bepaald::bytesToHexString(data + processed, length));
+        // an empty field at the very end would point one past 'data', which deleteFieldData()
+        // could not tell apart from an owned allocation. Point it at the start of 'data' instead.
+        framedata->emplace_back(fieldnumber, length ? data + processed : data, length);
         processed += length; // up to length was eaten
         break;
       }
@@ -62,13 +126,14 @@ bool BackupFrame::init(unsigned char *data, size_t l, std::vector<std::tuple<uns
         //DEBUGOUT("Got varint: ", val);
         val = bepaald::swap_endian(val); // because java writes integers in big endian?
         //DEBUGOUT("Got varint: ", val);
-        unsigned char *fielddata = new unsigned char[sizeof(decltype(val))];
+        unsigned char *fielddata = *varints;
         std::memcpy(fielddata, reinterpret_cast<unsigned char *>(&val), sizeof(decltype(val)));
+        *varints += sizeof(decltype(val));
         //DEBUGOUT("FIELDNUMB: ", fieldnumber);
         //DEBUGOUT("FIELDDATA: ", bepaald::bytesToHexString(fielddata, sizeof(decltype(val))));
 
         // this used to say sizeof(sizeof(decltype(val))), I assumed it was a mistake
-        framedata->push_back(std::make_tuple(fieldnumber, fielddata, sizeof(decltype(val))));
+        framedata->emplace_back(fieldnumber, fielddata, sizeof(decltype(val)));
         // processed is set in getVarInt
         break;
       }
@@ -86,11 +151,9 @@ bool BackupFrame::init(unsigned char *data, size_t l, std::vector<std::tuple<uns
         unsigned int length = 8;
         if (processed + length > l) // more then we have
           return false;
-        unsigned char *fielddata = new unsigned char[length];
-        std::memcpy(fielddata, data + processed, length);
         //DEBUGOUT("FIELDNUMB: ", fieldnumber);
-        //DEBUGOUT("FIELDDATA: ", bepaald::bytesToHexString(fielddata, length));
-        framedata->push_back(std::make_tuple(fieldnumber, fielddata, length));
+        //DEBUGOUT("FIELDDATA: ", bepaald::bytesToHexString(data + processed, length));
+        framedata->emplace_back(fieldnumber, data + processed, length);
         processed += length;
         break;
       }
@@ -20,6 +20,8 @@
 #ifndef BASEDECRYPTOR_H_
 #define BASEDECRYPTOR_H_
 
+#include <functional>
+
 #include "../cryptbase/cryptbase.h"
 
 class FrameWithAttachment;
@@ -29,6 +31,9 @@ class BaseDecryptor : public CryptBase
  public:
   inline BaseDecryptor() = default;
   static int getAttachment(FrameWithAttachment *frame);
+  static int getAttachment(FrameWithAttachment *frame, std::function<bool(unsigned char const *, uint32_t)> const &chunkhandler);
+ private:
+  static int readAttachment(FrameWithAttachment *frame, unsigned char *target, std::function<bool(unsigned char const *, uint32_t)> const &chunkhandler);
 };
 
 #endif
@@ -20,18 +20,51 @@
 #include "basedecryptor.ih"
 
 int BaseDecryptor::getAttachment(FrameWithAttachment *frame) // static
+{
+  std::unique_ptr<unsigned char[]> decryptedattachmentdata(new unsigned char[frame->length()]); // to hold the data
+  int result = readAttachment(frame, decryptedattachmentdata.get(), nullptr);
+  if (result == 1)
+    return 1;
+  if (!frame->setAttachmentData(decryptedattachmentdata.release()))
+    return 1;
+  return result;
+}
+
+/*
+  Decrypts the attachment in chunks, passing each decrypted chunk to 'chunkhandler' instead of
+  keeping the whole attachment in memory. As the mac can only be checked after all data is
+  processed, the handler will have seen all (possibly corrupted) data when -1 is returned.
+  Returns 0 on success, 1 on error (or if chunkhandler returned false) and -1 on bad mac.
+*/
+int BaseDecryptor::getAttachment(FrameWithAttachment *frame, std::function<bool(unsigned char const *, uint32_t)> const &chunkhandler) // static
+{
+  return readAttachment(frame, nullptr, chunkhandler);
+}
+
+// decrypts into 'target' if set (must hold frame->length() bytes), else in chunks to 'chunkhandler'
+int BaseDecryptor::readAttachment(FrameWithAttachment *frame, unsigned char *target,
+                                  std::function<bool(unsigned char const *, uint32_t)> const &chunkhandler) // static
 {
   //std::cout << " *** REALLY GETTING ATTACHMENT ***" << std::endl;
 
-  std::ifstream file(frame->filename(), std::ios_base::binary | std::ios_base::in);
-  if (!file.is_open())
+  // if the backup file is memory mapped, read straight from the mapping
+  MappedFile const *mappedfile = frame->mappedFile();
+  if (mappedfile && !mappedfile->contains(frame->filepos(), static_cast<uint64_t>(frame->length()) + MACSIZE)) [[unlikely]]
+    mappedfile = nullptr;
+
+  std::ifstream file;
+  if (!mappedfile)
   {
-    std::cout << "Failed to open backup file '" << frame->filename() << "' for reading attachment" << std::endl;
-    return 1;
-  }
+    file.open(frame->filename(), std::ios_base::binary | std::ios_base::in);
+    if (!file.is_open())
+    {
+      std::cout << "Failed to open backup file '" << frame->filename() << "' for reading attachment" << std::endl;
+      return 1;
+    }
 
-  //std::cout << "Getting attachment: " << frame->filepos() << " + " << frame->length() << std::endl;
-  file.seekg(frame->filepos(), std::ios_base::beg);
+    //std::cout << "Getting attachment: " << frame->filepos() << " + " << frame->length() << std::endl;
+    file.seekg(frame->filepos(), std::ios_base::beg);
+  }
 
   // RAW UNENCRYPTED FILE ATTACHMENT
   if (!frame->cipherkey() ||
@@ -39,50 +72,83 @@ int BaseDecryptor::getAttachment(FrameWithAttachment *frame) // static
       !frame->iv())
   {
     //std::cout << "GETTING RAW UNENCRYPTED DATA" << std::endl;
-    std::unique_ptr<unsigned char[]> decryptedattachmentdata(new unsigned char[frame->length()]); // to hold the data
-    if (!file.read(reinterpret_cast<char *>(decryptedattachmentdata.get()), frame->length()))
+    if (target)
     {
-      std::cout << "Failed to read raw attachment \"" << frame->filename() << "\"" << std::endl;
-      return 1;
+      if (mappedfile)
+        std::memcpy(target, mappedfile->data() + frame->filepos(), frame->length());
+      else if (!file.read(reinterpret_cast<char *>(target), frame->length()))
+      {
+        std::cout << "Failed to read raw attachment \"" << frame->filename() << "\"" << std::endl;
+        return 1;
+      }
+      return 0;
     }
-    frame->setAttachmentData(decryptedattachmentdata.release());
-    return 0;
-  }
-
-  // to decrypt the data
-  // create context
-  std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
 
-  // disable padding
-  EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
+    if (mappedfile)
+      return chunkhandler(mappedfile->data() + frame->filepos(), frame->length()) ? 0 : 1;
 
-  // init
-  if (EVP_DecryptInit_ex(ctx.get(), EVP_aes_256_ctr(), nullptr, frame->cipherkey(), frame->iv()) != 1)
-  {
-    std::cout << "CTX INIT FAILED" << std::endl;
-    return 1;
+    uint32_t const BUFFERSIZE = 1024 * 1024;
+    std::unique_ptr<unsigned char[]> buffer(new unsigned char[std::min(frame->length(), BUFFERSIZE)]);
+    for (uint32_t processed = 0; processed < frame->length(); )
+    {
+      uint32_t read = std::min(frame->length() - processed, BUFFERSIZE);
+      if (!file.read(reinterpret_cast<char *>(buffer.get()), read))
+      {
+        std::cout << "Failed to read raw attachment \"" << frame->filename() << "\"" << std::endl;
+        return 1;
+      }
+      if (!chunkhandler(buffer.get(), read))
+        return 1;
+      processed += read;
+    }
+    return 0;
   }
 
-  // to calculate the MAC
+  // the decryption and mac contexts are kept per thread and reused for every attachment,
+  // only the first call allocates them and sets the cipher and digest. Note this means
+  // 'chunkhandler' must not itself read another attachment.
+  thread_local std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
+  thread_local bool ctx_initialized = false;
 #if OPENSSL_VERSION_NUMBER >= 0x30000000L
-  std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
-  std::unique_ptr<EVP_MAC_CTX, decltype(&::EVP_MAC_CTX_free)> hctx(EVP_MAC_CTX_new(mac.get()), &::EVP_MAC_CTX_free);
+  thread_local std::unique_ptr<EVP_MAC_CTX, decltype(&::EVP_MAC_CTX_free)> hctx([]()
+  {
+    std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
+    return EVP_MAC_CTX_new(mac.get()); // holds its own reference to mac
+  }(), &::EVP_MAC_CTX_free);
+  thread_local bool hctx_initialized = false;
   char digest[] = "SHA256";
   OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string("digest", digest, 0), OSSL_PARAM_construct_end()};
 #else
-  std::unique_ptr<HMAC_CTX, decltype(&::HMAC_CTX_free)> hctx(HMAC_CTX_new(), &::HMAC_CTX_free);
+  thread_local std::unique_ptr<HMAC_CTX, decltype(&::HMAC_CTX_free)> hctx(HMAC_CTX_new(), &::HMAC_CTX_free);
 #endif
 
+  // init
+  if (!ctx || EVP_DecryptInit_ex(ctx.get(), ctx_initialized ? nullptr : EVP_aes_256_ctr(), nullptr, frame->cipherkey(), frame->iv()) != 1)
+  {
+    std::cout << "CTX INIT FAILED" << std::endl;
+    return 1;
+  }
+  if (!ctx_initialized) [[unlikely]]
+  {
+    // disable padding
+    EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
+    ctx_initialized = true;
+  }
 
+  // to calculate the MAC
 #if OPENSSL_VERSION_NUMBER >= 0x30000000L
-  if (EVP_MAC_init(hctx.get(), frame->mackey(), frame->mackey_size(), params) != 1)
+  if (!hctx || EVP_MAC_init(hctx.get(), frame->mackey(), frame->mackey_size(), hctx_initialized ? nullptr : params) != 1)
 #else
-  if (HMAC_Init_ex(hctx.get(), frame->mackey(), frame->mackey_size(), EVP_sha256(), nullptr) != 1)
+  if (!hctx || HMAC_Init_ex(hctx.get(), frame->mackey(), frame->mackey_size(), EVP_sha256(), nullptr) != 1)
 #endif
   {
     std::cout << "Failed to initialize HMAC context" << std::endl;
     return 1;
   }
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  hctx_initialized = true;
+#endif
+
 #if OPENSSL_VERSION_NUMBER >= 0x30000000L
   if (EVP_MAC_update(hctx.get(), frame->iv(), frame->iv_size()) != 1)
 #else
@@ -93,26 +159,63 @@ int BaseDecryptor::getAttachment(FrameWithAttachment *frame) // static
     return 1;
   }
 
-  // read and process attachment data in 8MB chunks
+  // read and process attachment data in chunks of 8KB (or 8MB when reading straight from the mapped file)
   uint32_t const BUFFERSIZE = 8 * 1024;
   unsigned char encrypteddatabuffer[BUFFERSIZE];
   uint32_t processed = 0;
   uint32_t size = frame->length();
-  std::unique_ptr<unsigned char[]> decryptedattachmentdata(new unsigned char[size]); // to hold the data
+  uint32_t const chunksize = std::min(size, (mappedfile ? 1024 : 1) * BUFFERSIZE);
+  // to hold the data when it is not decrypted into target. Buffers up to CACHEDCHUNKSIZE are reused
+  // like the contexts, larger ones (only for large attachments) are freed again when done, so every
+  // thread does not keep up to 8MB around for its whole lifetime
+  uint32_t const CACHEDCHUNKSIZE = 64 * 1024;
+  thread_local std::unique_ptr<unsigned char[]> cachedchunk;
+  thread_local uint32_t cachedchunk_size = 0;
+  std::unique_ptr<unsigned char[]> largechunk;
+  unsigned char *decryptedchunk = nullptr;
+  if (!target)
+  {
+    if (chunksize > CACHEDCHUNKSIZE) [[unlikely]]
+    {
+      largechunk.reset(new unsigned char[chunksize]);
+      decryptedchunk = largechunk.get();
+    }
+    else
+    {
+      if (chunksize > cachedchunk_size) [[unlikely]]
+      {
+        cachedchunk_size = CACHEDCHUNKSIZE;
+        cachedchunk.reset(new unsigned char[cachedchunk_size]);
+      }
+      decryptedchunk = cachedchunk.get();
+    }
+  }
+  if (mappedfile)
+    mappedfile->adviseWillNeed(frame->filepos(), static_cast<uint64_t>(size) + MACSIZE);
   while (processed < size)
   {
-    if (!file.read(reinterpret_cast<char *>(encrypteddatabuffer), std::min(size - processed, BUFFERSIZE)))
+    unsigned char const *encrypteddata = encrypteddatabuffer;
+    uint32_t read = 0;
+    if (mappedfile) [[likely]] // no copy, the chunk size only keeps lengths within int range
     {
-      std::cout << " STOPPING BEFORE END OF ATTACHMENT!!!" << (file.eof() ? " (EOF) " : "") << std::endl;
-      return 1;
+      encrypteddata = mappedfile->data() + frame->filepos() + processed;
+      read = std::min(size - processed, 1024 * BUFFERSIZE);
+    }
+    else
+    {
+      if (!file.read(reinterpret_cast<char *>(encrypteddatabuffer), std::min(size - processed, BUFFERSIZE)))
+      {
+        std::cout << " STOPPING BEFORE END OF ATTACHMENT!!!" << (file.eof() ? " (EOF) " : "") << std::endl;
+        return 1;
+      }
+      read = file.gcount();
     }
-    uint32_t read = file.gcount();
 
     // update MAC with read data
 #if OPENSSL_VERSION_NUMBER >= 0x30000000L
-    if (EVP_MAC_update(hctx.get(), encrypteddatabuffer, read) != 1)
+    if (EVP_MAC_update(hctx.get(), encrypteddata, read) != 1)
 #else
-    if (HMAC_Update(hctx.get(), encrypteddatabuffer, read) != 1)
+    if (HMAC_Update(hctx.get(), encrypteddata, read) != 1)
 #endif
     {
       std::cout << "Failed to update HMAC" << std::endl;
@@ -120,12 +223,15 @@ int BaseDecryptor::getAttachment(FrameWithAttachment *frame) // static
     }
 
     // decrypt the read data;
+    unsigned char *decrypteddata = target ? target + processed : decryptedchunk;
     int spaceleft = size - processed;
-    if (EVP_DecryptUpdate(ctx.get(), decryptedattachmentdata.get() + processed, &spaceleft, encrypteddatabuffer, read) != 1)
+    if (EVP_DecryptUpdate(ctx.get(), decrypteddata, &spaceleft, encrypteddata, read) != 1)
     {
       std::cout << "Failed to decrypt data" << std::endl;
       return 1;
     }
+    if (!target && !chunkhandler(decrypteddata, read))
+      return 1;
 
     processed += read;
     //return;
@@ -147,7 +253,12 @@ int BaseDecryptor::getAttachment(FrameWithAttachment *frame) // static
   }
 
   unsigned char theirMac[MACSIZE];
-  if (!file.read(reinterpret_cast<char *>(theirMac), MACSIZE))
+  if (mappedfile)
+  {
+    std::memcpy(theirMac, mappedfile->data() + frame->filepos() + size, MACSIZE);
+    mappedfile->adviseDontNeed(frame->filepos(), static_cast<uint64_t>(size) + MACSIZE);
+  }
+  else if (!file.read(reinterpret_cast<char *>(theirMac), MACSIZE))
   {
     std::cout << " STOPPING BEFORE END OF ATTACHMENT!!! 2 " << std::endl;
     return 1;
@@ -156,7 +267,6 @@ int BaseDecryptor::getAttachment(FrameWithAttachment *frame) // static
   DEBUGOUT("ourMac           : ", bepaald::bytesToHexString(hash, SHA256_DIGEST_LENGTH));
 
   bool badmac = false;
-
   if (std::memcmp(theirMac, hash, MACSIZE) != 0)
   {
     std::cout << "" << std::endl;
@@ -168,11 +278,5 @@ int BaseDecryptor::getAttachment(FrameWithAttachment *frame) // static
   else
     badmac = false;
 
-  if (frame->setAttachmentData(decryptedattachmentdata.release()))
-  {
-    if (badmac)
-      return -1;
-    return 0;
-  }
-  return 1;
+  return badmac ? -1 : 0;
 }
@@ -92,6 +92,7 @@ namespace bepaald
   inline int numDigits(long long int num);
   inline bool supportsAnsi();
   inline bool isTerminal();
+  inline uint64_t physicalMemory();
   inline std::ostream &bold_on(std::ostream &os);
   inline std::ostream &bold_off(std::ostream &os);
   inline std::string toDateString(std::time_t epoch, std::string const &format);
@@ -371,6 +372,23 @@ inline bool bepaald::isTerminal()
 #endif
 }
 
+// returns 0 if unknown
+inline uint64_t bepaald::physicalMemory()
+{
+#if defined(_WIN32) || defined(__MINGW64__)
+  MEMORYSTATUSEX status;
+  status.dwLength = sizeof(status);
+  if (GlobalMemoryStatusEx(&status))
+    return status.ullTotalPhys;
+#elif defined(HAS_UNISTD_H_) && defined(_SC_PHYS_PAGES) && defined(_SC_PAGESIZE)
+  long pages = sysconf(_SC_PHYS_PAGES);
+  long pagesize = sysconf(_SC_PAGESIZE);
+  if (pages > 0 && pagesize > 0)
+    return static_cast<uint64_t>(pages) * pagesize;
+#endif
+  return 0;
+}
+
 inline std::ostream &bepaald::bold_on(std::ostream &os)
 {
   if (!supportsAnsi() || !isTerminal()) [[unlikely]]
@@ -387,8 +405,15 @@ inline std::ostream &bepaald::bold_off(std::ostream &os)
 
 inline std::string bepaald::toDateString(std::time_t epoch, std::string const &format)
 {
+  // not std::localtime(), this may be called from several threads at once
+  std::tm tm{};
+#if defined(_WIN32) || defined(__MINGW64__)
+  localtime_s(&tm, &epoch);
+#else
+  localtime_r(&epoch, &tm);
+#endif
   std::ostringstream tmp;
-  tmp << std::put_time(std::localtime(&epoch), format.c_str());
+  tmp << std::put_time(&tm, format.c_str());
   return tmp.str();
 }
 
@@ -22,6 +22,12 @@
 
 #include <cstring>
 #include <cctype>
+#include <array>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <openssl/crypto.h>
 
 #include "../common_be.h"
 
@@ -41,15 +47,37 @@ class CryptBase
   unsigned char *d_salt;
   uint64_t d_salt_size;
   uint64_t d_counter;
+
+  // backup keys derived earlier in this process, only used when enabled. Keyed on
+  // a sha256 of salt + passphrase, the key itself is wiped when the entry is removed
+  class CachedKey
+  {
+    unsigned char d_key[32];
+   public:
+    inline explicit CachedKey(unsigned char const *key);
+    CachedKey(CachedKey const &other) = delete;
+    CachedKey &operator=(CachedKey const &other) = delete;
+    inline ~CachedKey();
+    inline unsigned char const *data() const;
+  };
+  static bool s_keycache_enabled;
+  static std::mutex s_keycache_mutex;
+  static std::map<std::array<unsigned char, 32>, CachedKey> s_keycache;
+
  public:
   inline CryptBase();
   CryptBase(CryptBase const &other) = delete;
   CryptBase operator=(CryptBase const &other) = delete;
   inline ~CryptBase();
   inline bool ok() const;
+  static inline void enableKeyCache(bool enable = true);
+  static void clearKeyCache();
+  static void precomputeBackupKeys(std::vector<std::pair<std::vector<unsigned char>, std::string>> const &saltsandpassphrases);
  protected:
   bool getCipherAndMac(uint hashoutputsize, size_t outputsize);
   bool getBackupKey(std::string const &passphrase);
+  static bool deriveBackupKey(unsigned char const *salt, uint64_t salt_size, std::string const &passphrase,
+                              unsigned char *key, bool printerrors = true);
   inline void uintToFourBytes(unsigned char *bytes, uint32_t val) const;
   inline uint32_t fourBytesToUint(unsigned char *b) const;
 };
@@ -84,6 +112,31 @@ inline bool CryptBase::ok() const
   return d_ok;
 }
 
+inline void CryptBase::enableKeyCache(bool enable) // static
+{
+  {
+    std::lock_guard<std::mutex> lock(s_keycache_mutex);
+    s_keycache_enabled = enable;
+  }
+  if (!enable)
+    clearKeyCache();
+}
+
+inline CryptBase::CachedKey::CachedKey(unsigned char const *key)
+{
+  std::memcpy(d_key, key, sizeof(d_key));
+}
+
+inline CryptBase::CachedKey::~CachedKey()
+{
+  OPENSSL_cleanse(d_key, sizeof(d_key));
+}
+
+inline unsigned char const *CryptBase::CachedKey::data() const
+{
+  return d_key;
+}
+
 inline void CryptBase::uintToFourBytes(unsigned char *bytes, uint32_t val) const
 {
   val = bepaald::swap_endian(val);
@@ -0,0 +1,136 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "cryptbase.ih"
+
+bool CryptBase::deriveBackupKey(unsigned char const *salt, uint64_t salt_size, std::string const &passphrase,
+                                unsigned char *key, bool printerrors) // static
+{
+  // convert passwords digits to unsigned char *
+  size_t const passlength = 30;
+  unsigned char pass[passlength];
+  uint i = 0;
+  uint j = 0;
+  while (i < passlength && j < passphrase.size())
+  {
+    if (!std::isdigit(passphrase[j])) // skip non digits
+      ++j;
+    else
+      pass[i++] = passphrase[j++];
+  }
+
+  while (j < passphrase.size() && !std::isdigit(passphrase[j])) // also eat any trailing non-digits
+    ++j;
+
+  if (i != passlength)
+  {
+    if (printerrors)
+      std::cout << "ERROR : Failed to parse passphrase from string '" << passphrase << "' : passphrase too short! Need " << passlength << " digits, " << i << " provided" << std::endl;
+    return false;
+  }
+
+  if (j != passphrase.size()) // passlength == 30 && all chars in passphrase were processed
+  {
+    if (printerrors)
+      std::cout << "ERROR : Failed to parse passphrase from string '" << passphrase << "' : passphrase too long! Need " << passlength << " digits" << std::endl;
+    return false;
+  }
+
+  //std::cout << "Passphrase: " << bepaald::bytesToHexString(pass, passlength) << std::endl;
+
+  std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_free)> mdctx(EVP_MD_CTX_create(), &::EVP_MD_CTX_free);
+
+  // deriving the key is slow (on purpose), if this backup was opened before, reuse the key
+  std::array<unsigned char, 32> cacheid;
+  bool usecache = false;
+  {
+    std::lock_guard<std::mutex> lock(s_keycache_mutex);
+    usecache = s_keycache_enabled;
+  }
+  if (usecache)
+  {
+    if (mdctx.get() == nullptr ||
+        EVP_DigestInit_ex(mdctx.get(), EVP_sha256(), nullptr) != 1 ||
+        EVP_DigestUpdate(mdctx.get(), salt, salt_size) != 1 ||
+        EVP_DigestUpdate(mdctx.get(), pass, passlength) != 1 ||
+        EVP_DigestFinal_ex(mdctx.get(), cacheid.data(), nullptr) != 1)
+    {
+      OPENSSL_cleanse(pass, passlength);
+      if (printerrors)
+        std::cout << "Failed to create message digest context" << std::endl;
+      return false;
+    }
+
+    std::lock_guard<std::mutex> lock(s_keycache_mutex);
+    auto it = s_keycache.find(cacheid);
+    if (it != s_keycache.end())
+    {
+      OPENSSL_cleanse(pass, passlength);
+      std::memcpy(key, it->second.data(), 32);
+      return true;
+    }
+  }
+
+  if (mdctx.get() == nullptr ||
+      EVP_DigestInit_ex(mdctx.get(), EVP_sha512(), nullptr) != 1)
+  {
+    OPENSSL_cleanse(pass, passlength);
+    if (printerrors)
+      std::cout << "Failed to create message digest context" << std::endl;
+    return false;
+  }
+
+  EVP_DigestUpdate(mdctx.get(), salt, salt_size);
+
+  unsigned long digest_size = EVP_MD_size(EVP_sha512());
+  std::unique_ptr<unsigned char[]> digest(new unsigned char[digest_size]);
+
+  for (i = 0; i < 250000; ++i)
+  {
+    if (i > 0)
+      EVP_DigestUpdate(mdctx.get(), digest.get(), digest_size);
+    else
+      EVP_DigestUpdate(mdctx.get(), pass, passlength);
+    EVP_DigestUpdate(mdctx.get(), pass, passlength);
+
+    // reinitialize with the same digest, (unlike reset + init) this does not look up the implementation again
+    if (EVP_DigestFinal_ex(mdctx.get(), digest.get(), nullptr) != 1 ||
+        EVP_DigestInit_ex(mdctx.get(), nullptr, nullptr) != 1)
+    {
+      OPENSSL_cleanse(digest.get(), digest_size);
+      OPENSSL_cleanse(pass, passlength);
+      if (printerrors)
+        std::cout << "Failed to reset digest context" << std::endl;
+      return false;
+    }
+  }
+
+  std::memcpy(key, digest.get(), 32); // backupkey is digest trimmed to 32 bytes
+
+  if (usecache)
+  {
+    std::lock_guard<std::mutex> lock(s_keycache_mutex);
+    s_keycache.try_emplace(cacheid, key);
+  }
+
+  OPENSSL_cleanse(digest.get(), digest_size);
+  OPENSSL_cleanse(pass, passlength);
+
+  return true;
+}
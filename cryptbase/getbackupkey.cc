@@ -21,70 +21,14 @@
 
 bool CryptBase::getBackupKey(std::string const &passphrase)
 {
-  // convert passwords digits to unsigned char *
-  size_t const passlength = 30;
-  unsigned char pass[passlength];
-  uint i = 0;
-  uint j = 0;
-  while (i < passlength && j < passphrase.size())
-  {
-    if (!std::isdigit(passphrase[j])) // skip non digits
-      ++j;
-    else
-      pass[i++] = passphrase[j++];
-  }
-
-  while (j < passphrase.size() && !std::isdigit(passphrase[j])) // also eat any trailing non-digits
-    ++j;
-
-  if (i != passlength)
-  {
-    std::cout << "ERROR : Failed to parse passphrase from string '" << passphrase << "' : passphrase too short! Need " << passlength << " digits, " << i << " provided" << std::endl;
-    return false;
-  }
-
-  if (j != passphrase.size()) // passlength == 30 && all chars in passphrase were processed
-  {
-    std::cout << "ERROR : Failed to parse passphrase from string '" << passphrase << "' : passphrase too long! Need " << passlength << " digits" << std::endl;
-    return false;
-  }
-
-  //std::cout << "Passphrase: " << bepaald::bytesToHexString(pass, passlength) << std::endl;
+  bepaald::destroyPtr(&d_backupkey, &d_backupkey_size);
 
-  std::unique_ptr<EVP_MD_CTX, decltype(&::EVP_MD_CTX_free)> mdctx(EVP_MD_CTX_create(), &::EVP_MD_CTX_free);
-
-  if (mdctx.get() == nullptr ||
-      EVP_DigestInit_ex(mdctx.get(), EVP_sha512(), nullptr) != 1)
+  d_backupkey_size = 32;
+  d_backupkey = new unsigned char[d_backupkey_size];
+  if (!deriveBackupKey(d_salt, d_salt_size, passphrase, d_backupkey))
   {
-    std::cout << "Failed to create message digest context" << std::endl;
+    bepaald::destroyPtr(&d_backupkey, &d_backupkey_size);
     return false;
   }
-
-  EVP_DigestUpdate(mdctx.get(), d_salt, d_salt_size);
-
-  unsigned long digest_size = EVP_MD_size(EVP_sha512());
-  std::unique_ptr<unsigned char[]> digest(new unsigned char[digest_size]);
-
-  for (i = 0; i < 250000; ++i)
-  {
-    if (i > 0)
-      EVP_DigestUpdate(mdctx.get(), digest.get(), digest_size);
-    else
-      EVP_DigestUpdate(mdctx.get(), pass, passlength);
-    EVP_DigestUpdate(mdctx.get(), pass, passlength);
-
-    EVP_DigestFinal(mdctx.get(), digest.get(), nullptr);
-    if (EVP_MD_CTX_reset(mdctx.get()) != 1 ||
-        EVP_DigestInit_ex(mdctx.get(), EVP_sha512(), nullptr) != 1)
-    {
-      std::cout << "Failed to reset digest context" << std::endl;
-      return false;
-    }
-  }
-
-  d_backupkey_size = 32; // backupkey is digest trimmed to 32 bytes
-  d_backupkey = new unsigned char[d_backupkey_size];
-  std::memcpy(d_backupkey, digest.get(), d_backupkey_size);
-
   return true;
 }
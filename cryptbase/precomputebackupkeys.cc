@@ -0,0 +1,54 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "cryptbase.ih"
+
+#include <algorithm>
+#include <thread>
+
+/*
+  Derive the keys for several backups at once, each on its own thread, and
+  store them in the key cache. Does nothing if the cache is not enabled.
+*/
+void CryptBase::precomputeBackupKeys(std::vector<std::pair<std::vector<unsigned char>, std::string>> const &saltsandpassphrases) // static
+{
+  {
+    std::lock_guard<std::mutex> lock(s_keycache_mutex);
+    if (!s_keycache_enabled)
+      return;
+  }
+
+  std::vector<std::pair<std::vector<unsigned char>, std::string> const *> todo;
+  for (auto const &sp : saltsandpassphrases)
+    if (!sp.first.empty() &&
+        std::find_if(todo.begin(), todo.end(), [&](auto const *t) { return *t == sp; }) == todo.end())
+      todo.push_back(&sp);
+
+  // errors are not printed here, they show up when the backup is actually opened
+  std::vector<std::thread> threads;
+  for (auto const *sp : todo)
+    threads.emplace_back([sp]()
+    {
+      unsigned char key[32];
+      deriveBackupKey(sp->first.data(), sp->first.size(), sp->second, key, false);
+      OPENSSL_cleanse(key, sizeof(key));
+    });
+  for (auto &t : threads)
+    t.join();
+}
@@ -31,7 +31,15 @@ FileDecryptor::FileDecryptor(std::string const &filename, std::string const &pas
   d_editattachments(editattachments),
   d_verbose(verbose),
   d_stoponerror(stoponerror),
-  d_backupfileversion(0)
+  d_backupfileversion(0),
+  d_decodebuffer_size(0),
+  d_readbuffer_size(0),
+  d_framectx(nullptr),
+  d_framehctx(nullptr),
+  d_pipelinestarted(false),
+  d_pipelinestop(false),
+  d_pipelinebytes(0),
+  d_curfilepos(0)
 {
   if (!d_file.is_open())
   {
@@ -129,5 +137,19 @@ FileDecryptor::FileDecryptor(std::string const &filename, std::string const &pas
 
   d_headerframe.reset(headerframe);
 
+  // map the file for reading the rest of the frames and (lazily) their attachment data.
+  // This is not done for the oldest backup version, whose reader still uses d_file.
+  if (d_backupfileversion > 0)
+  {
+    d_mappedfile = std::make_shared<MappedFile>(d_filename);
+    if (d_mappedfile->ok() && d_mappedfile->size() == d_filesize) [[likely]]
+    {
+      d_mappedfile->adviseSequential();
+      d_curfilepos = d_file.tellg();
+    }
+    else
+      d_mappedfile.reset();
+  }
+
   d_ok = true;
 }
@@ -22,12 +22,20 @@
 
 #include <cstring>
 #include <fstream>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
 
 //#include "../cryptbase/cryptbase.h"
 #include "../common_be.h"
 #include "../backupframe/backupframe.h"
 #include "../framewithattachment/framewithattachment.h"
 #include "../basedecryptor/basedecryptor.h"
+#include "../mappedfile/mappedfile.h"
 #include "../invalidframe/invalidframe.h"
 
 class  FileDecryptor : public BaseDecryptor//, public CryptBase
@@ -43,18 +51,64 @@ class  FileDecryptor : public BaseDecryptor//, public CryptBase
   bool d_verbose;
   bool d_stoponerror;
   uint32_t d_backupfileversion;
+  std::shared_ptr<MappedFile> d_mappedfile; // if set, frames are read from here, d_file is only used for the header
+  std::unique_ptr<unsigned char[]> d_decodebuffer;
+  uint32_t d_decodebuffer_size;
+  std::unique_ptr<unsigned char[]> d_readbuffer; // holds encrypted frames when the file is not mapped
+  uint32_t d_readbuffer_size;
+
+  // contexts for reading frames serially, created once and reinitialized for every frame
+  EVP_CIPHER_CTX *d_framectx;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  EVP_MAC_CTX *d_framehctx;
+#else
+  HMAC_CTX *d_framehctx;
+#endif
+
+  // pipelined reading: one thread scans frame boundaries, workers verify/decrypt/parse
+  struct PipelineItem
+  {
+    uint64_t framecount;
+    uint64_t filepos;      // file position after this frame (and its attachment data)
+    uint32_t counter;      // iv counter for this frame
+    std::unique_ptr<unsigned char[]> data; // owns 'encrypted' when file is not mapped
+    unsigned char const *encrypted; // encrypted frame length + encrypted frame (incl. mac)
+    uint32_t datalength;
+    std::unique_ptr<BackupFrame> frame;
+    std::string message;   // printed by consumer, keeps output in file order
+    bool badmac;
+    bool last;
+    bool done;
+  };
+  static unsigned int constexpr s_pipeline_maxworkers = 8;
+  static unsigned int constexpr s_pipeline_maxitems = 1024;
+  static uint64_t constexpr s_pipeline_maxbytes = 64 * 1024 * 1024;
+  bool d_pipelinestarted;
+  bool d_pipelinestop;
+  uint64_t d_pipelinebytes;
+  uint64_t d_curfilepos;
+  std::deque<std::unique_ptr<PipelineItem>> d_pipeline; // in file order
+  std::deque<PipelineItem *> d_workqueue;
+  std::mutex d_pipelinemutex;
+  std::condition_variable d_workavailable;
+  std::condition_variable d_resultavailable;
+  std::condition_variable d_spaceavailable;
+  std::thread d_scanner;
+  std::vector<std::thread> d_workers;
 
  public:
   FileDecryptor(std::string const &filename, std::string const &passphrase, bool verbose, bool stoponerror = false, bool assumebadframesize = false, std::vector<long long int> editattachments = std::vector<long long int>());
   FileDecryptor(FileDecryptor const &other) = delete;
   FileDecryptor operator=(FileDecryptor const &other) = delete;
-  //inline ~FileDecryptor();
+  ~FileDecryptor();
   inline bool ok() const;
   std::unique_ptr<BackupFrame> getFrameOld();
   std::unique_ptr<BackupFrame> getFrame();
   inline uint64_t total() const;
   inline uint64_t curFilePos();
+  inline bool pipelineSupported() const;
   inline bool badMac() const;
+  static std::vector<unsigned char> readSalt(std::string const &filename);
 
   // temporary
   void ashmorgan();
@@ -65,11 +119,31 @@ class  FileDecryptor : public BaseDecryptor//, public CryptBase
   void strugee3(uint64_t pos);
 
  private:
+  inline uint64_t filePos();
+  inline bool readFrameBytes(unsigned char *data, uint64_t length);
+  inline unsigned char const *frameData(uint32_t length);
+  inline void skipFrameBytes(uint64_t length);
+  inline unsigned char *decodeBuffer(uint32_t length);
+  bool initFrameContexts();
   inline uint32_t getNextFrameBlockSize();
   inline bool getNextFrameBlock(unsigned char *data, size_t length);
-  BackupFrame *initBackupFrame(unsigned char *data, size_t length, uint64_t count = 0) const;
+  static BackupFrame *initBackupFrame(unsigned char *data, size_t length, uint64_t count = 0);
   //virtual int getAttachment(FrameWithAttachment *frame) override;
 
+  std::unique_ptr<BackupFrame> getFramePipelined();
+  void startPipeline(unsigned int numworkers);
+  void stopPipeline();
+  void pipelineScanner(uint64_t filepos);
+  void pipelineWorker();
+  void pipelinePush(std::unique_ptr<PipelineItem> &&item, bool needswork);
+  bool pipelineProcess(PipelineItem *item, unsigned char *iv, EVP_CIPHER_CTX *ctx,
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+                       EVP_MAC_CTX *hctx
+#else
+                       HMAC_CTX *hctx
+#endif
+                       ) const;
+
   std::unique_ptr<BackupFrame> bruteForceFrom(uint64_t filepos, uint32_t previousframelength);
   std::unique_ptr<BackupFrame> getFrameBrute(uint64_t offset, uint32_t previousframelength);
 };
@@ -86,7 +160,16 @@ inline uint64_t FileDecryptor::total() const
 
 inline uint64_t FileDecryptor::curFilePos()
 {
-  return d_file.tellg();
+  if (d_pipelinestarted)
+    return d_curfilepos;
+  return filePos();
+}
+
+// the pipelined reader does not support the (older) unencrypted frame lengths,
+// nor the recovery/debug options that need to inspect every frame serially
+inline bool FileDecryptor::pipelineSupported() const
+{
+  return d_backupfileversion > 0 && !d_verbose && !d_assumebadframesize && d_editattachments.empty();
 }
 
 inline bool FileDecryptor::badMac() const
@@ -94,6 +177,66 @@ inline bool FileDecryptor::badMac() const
   return d_badmac;
 }
 
+inline uint64_t FileDecryptor::filePos()
+{
+  if (d_mappedfile)
+    return d_curfilepos;
+  return d_file.tellg();
+}
+
+inline bool FileDecryptor::readFrameBytes(unsigned char *data, uint64_t length)
+{
+  if (d_mappedfile) [[likely]]
+  {
+    if (!d_mappedfile->contains(d_curfilepos, length)) [[unlikely]]
+      return false;
+    std::memcpy(data, d_mappedfile->data() + d_curfilepos, length);
+    d_curfilepos += length;
+    return true;
+  }
+  return static_cast<bool>(d_file.read(reinterpret_cast<char *>(data), length));
+}
+
+// returns a pointer into the mapped file, or reads into d_readbuffer if the file is not mapped.
+// in the latter case, the data is valid until the next call.
+inline unsigned char const *FileDecryptor::frameData(uint32_t length)
+{
+  if (d_mappedfile) [[likely]]
+  {
+    if (!d_mappedfile->contains(d_curfilepos, length)) [[unlikely]]
+      return nullptr;
+    unsigned char const *data = d_mappedfile->data() + d_curfilepos;
+    d_curfilepos += length;
+    return data;
+  }
+  if (length > d_readbuffer_size) [[unlikely]]
+  {
+    d_readbuffer.reset(new unsigned char[length]);
+    d_readbuffer_size = length;
+  }
+  if (!d_file.read(reinterpret_cast<char *>(d_readbuffer.get()), length))
+    return nullptr;
+  return d_readbuffer.get();
+}
+
+inline void FileDecryptor::skipFrameBytes(uint64_t length)
+{
+  if (d_mappedfile) [[likely]]
+    d_curfilepos += length;
+  else
+    d_file.seekg(length, std::ios_base::cur);
+}
+
+inline unsigned char *FileDecryptor::decodeBuffer(uint32_t length)
+{
+  if (length > d_decodebuffer_size) [[unlikely]]
+  {
+    d_decodebuffer.reset(new unsigned char[length]);
+    d_decodebuffer_size = length;
+  }
+  return d_decodebuffer.get();
+}
+
 // only used by getFrameOld(), used in older backups where frame length was not encrypted
 inline uint32_t FileDecryptor::getNextFrameBlockSize()
 {
@@ -0,0 +1,388 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+#include <sstream>
+
+void FileDecryptor::startPipeline(unsigned int numworkers)
+{
+  d_curfilepos = filePos();
+  d_pipelinestarted = true;
+  d_scanner = std::thread(&FileDecryptor::pipelineScanner, this, d_curfilepos);
+  for (uint i = 0; i < numworkers; ++i)
+    d_workers.emplace_back(&FileDecryptor::pipelineWorker, this);
+}
+
+void FileDecryptor::stopPipeline()
+{
+  {
+    std::lock_guard<std::mutex> lock(d_pipelinemutex);
+    d_pipelinestop = true;
+  }
+  d_workavailable.notify_all();
+  d_spaceavailable.notify_all();
+  d_resultavailable.notify_all();
+
+  if (d_scanner.joinable())
+    d_scanner.join();
+  for (auto &w : d_workers)
+    if (w.joinable())
+      w.join();
+  d_workers.clear();
+}
+
+// called by getFrame() once pipelining has started. Returns frames in file order.
+std::unique_ptr<BackupFrame> FileDecryptor::getFramePipelined()
+{
+  if (d_pipelinestop) [[unlikely]]
+    return std::unique_ptr<BackupFrame>(nullptr);
+
+  std::unique_ptr<PipelineItem> item;
+  {
+    std::unique_lock<std::mutex> lock(d_pipelinemutex);
+    d_resultavailable.wait(lock, [this]() { return !d_pipeline.empty() && d_pipeline.front()->done; });
+    item = std::move(d_pipeline.front());
+    d_pipeline.pop_front();
+    d_pipelinebytes -= item->datalength;
+  }
+  d_spaceavailable.notify_one();
+
+  if (!item->message.empty()) [[unlikely]]
+    std::cout << item->message << std::flush;
+
+  d_badmac = item->badmac;
+  d_curfilepos = item->filepos;
+  d_framecount = item->framecount + 1;
+
+  if (!item->frame) [[unlikely]]
+  {
+    stopPipeline();
+    return std::unique_ptr<BackupFrame>(nullptr);
+  }
+  return std::move(item->frame);
+}
+
+void FileDecryptor::pipelinePush(std::unique_ptr<PipelineItem> &&item, bool needswork)
+{
+  {
+    std::unique_lock<std::mutex> lock(d_pipelinemutex);
+    d_spaceavailable.wait(lock, [&]() { return d_pipelinestop || d_pipeline.empty() ||
+                                          (d_pipeline.size() < s_pipeline_maxitems &&
+                                           d_pipelinebytes + item->datalength <= s_pipeline_maxbytes); });
+    if (d_pipelinestop)
+      return;
+
+    d_pipelinebytes += item->datalength;
+    if (needswork)
+      d_workqueue.push_back(item.get());
+    d_pipeline.emplace_back(std::move(item));
+  }
+  if (needswork)
+    d_workavailable.notify_one();
+  else
+    d_resultavailable.notify_one();
+}
+
+/*
+  Reads the file from the current position, in order. Only the frame length
+  and the first byte of each frame (which determines its type) are decrypted here,
+  the remaining work is left to the worker threads. Frames that carry attachment
+  data are processed completely, since their contents are needed to find the
+  start of the next frame.
+*/
+void FileDecryptor::pipelineScanner(uint64_t filepos)
+{
+  std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
+  EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
+  std::unique_ptr<EVP_MAC_CTX, decltype(&::EVP_MAC_CTX_free)> hctx(EVP_MAC_CTX_new(mac.get()), &::EVP_MAC_CTX_free);
+#else
+  std::unique_ptr<HMAC_CTX, decltype(&::HMAC_CTX_free)> hctx(HMAC_CTX_new(), &::HMAC_CTX_free);
+#endif
+  std::unique_ptr<unsigned char[]> iv(new unsigned char[d_iv_size]);
+  std::memcpy(iv.get(), d_iv, d_iv_size);
+
+  uint32_t counter = d_counter;
+  uint64_t framecount = d_framecount;
+
+  while (true)
+  {
+    {
+      std::lock_guard<std::mutex> lock(d_pipelinemutex);
+      if (d_pipelinestop)
+        return;
+    }
+
+    std::unique_ptr<PipelineItem> item(new PipelineItem{framecount++, filepos, counter, nullptr, nullptr, 0, nullptr,
+                                                        std::string(), false, false, false});
+    auto finish = [&](std::string const &msg)
+    {
+      item->message += msg;
+      item->frame.reset();
+      item->last = true;
+      item->done = true;
+      pipelinePush(std::move(item), false);
+    };
+
+    if (filepos == d_filesize) [[unlikely]]
+    {
+      finish("Read entire backup file...\n");
+      return;
+    }
+
+    uint32_t encrypted_encryptedframelength = 0;
+    if (d_mappedfile && d_mappedfile->contains(filepos, sizeof(decltype(encrypted_encryptedframelength)))) [[likely]]
+      std::memcpy(&encrypted_encryptedframelength, d_mappedfile->data() + filepos, sizeof(decltype(encrypted_encryptedframelength)));
+    else if (d_mappedfile || !d_file.read(reinterpret_cast<char *>(&encrypted_encryptedframelength), sizeof(decltype(encrypted_encryptedframelength)))) [[unlikely]]
+    {
+      finish("Failed to read " + bepaald::toString(sizeof(decltype(encrypted_encryptedframelength))) +
+             " bytes from file to get next frame size... (" + bepaald::toString(filepos) + " / " + bepaald::toString(d_filesize) + ")\n");
+      return;
+    }
+
+    // decrypt frame length
+    uintToFourBytes(iv.get(), counter);
+    if (EVP_DecryptInit_ex(ctx.get(), EVP_aes_256_ctr(), nullptr, d_cipherkey, iv.get()) != 1) [[unlikely]]
+    {
+      finish("CTX INIT FAILED\n");
+      return;
+    }
+
+    uint32_t encryptedframelength = 0;
+    int encryptedframelength_size = sizeof(decltype(encryptedframelength));
+    if (EVP_DecryptUpdate(ctx.get(), reinterpret_cast<unsigned char *>(&encryptedframelength), &encryptedframelength_size,
+                          reinterpret_cast<unsigned char *>(&encrypted_encryptedframelength),
+                          sizeof(decltype(encrypted_encryptedframelength))) != 1) [[unlikely]]
+    {
+      finish("Failed to decrypt data\n");
+      return;
+    }
+    encryptedframelength = bepaald::swap_endian<uint32_t>(encryptedframelength);
+
+    if (encryptedframelength > 115343360 /*110MB*/ || encryptedframelength < 11) [[unlikely]]
+    {
+      std::ostringstream msg;
+      msg << "Failed to read next frame (" << encryptedframelength << " bytes at filepos " << filepos << ")" << std::endl;
+      if (item->framecount == 1)
+        msg << bepaald::bold_on << " *** NOTE : IT IS LIKELY AN INCORRECT PASSPHRASE WAS PROVIDED ***" << bepaald::bold_off << std::endl;
+      finish(msg.str());
+      return;
+    }
+
+    // get the encrypted frame data, prefixed with the (encrypted) length, as both are covered by the MAC
+    item->datalength = sizeof(decltype(encrypted_encryptedframelength)) + encryptedframelength;
+    if (d_mappedfile) [[likely]]
+    {
+      if (!d_mappedfile->contains(filepos, item->datalength)) [[unlikely]]
+      {
+        finish("Failed to read next frame (" + bepaald::toString(encryptedframelength) + " bytes at filepos " + bepaald::toString(filepos) + ")\n");
+        return;
+      }
+      item->encrypted = d_mappedfile->data() + filepos;
+    }
+    else
+    {
+      item->data.reset(new unsigned char[item->datalength]);
+      std::memcpy(item->data.get(), &encrypted_encryptedframelength, sizeof(decltype(encrypted_encryptedframelength)));
+      if (!d_file.read(reinterpret_cast<char *>(item->data.get() + sizeof(decltype(encrypted_encryptedframelength))), encryptedframelength)) [[unlikely]]
+      {
+        finish("Failed to read next frame (" + bepaald::toString(encryptedframelength) + " bytes at filepos " + bepaald::toString(filepos) + ")\n");
+        return;
+      }
+      item->encrypted = item->data.get();
+    }
+    ++counter;
+    filepos += item->datalength;
+
+    // peek at frame type
+    unsigned char head = 0;
+    int head_size = 1;
+    if (EVP_DecryptUpdate(ctx.get(), &head, &head_size, item->encrypted + sizeof(decltype(encrypted_encryptedframelength)), 1) != 1) [[unlikely]]
+    {
+      finish("Failed to decrypt data\n");
+      return;
+    }
+    int fieldnum = BackupFrame::getFieldnumber(head);
+
+    if (fieldnum != BackupFrame::FRAMETYPE::ATTACHMENT &&
+        fieldnum != BackupFrame::FRAMETYPE::AVATAR &&
+        fieldnum != BackupFrame::FRAMETYPE::STICKER) [[likely]]
+    {
+      item->filepos = filepos;
+      pipelinePush(std::move(item), true);
+      continue;
+    }
+
+    // frame carries attachment: process it here, its length is needed to continue
+    if (!pipelineProcess(item.get(), iv.get(), ctx.get(), hctx.get()) || item->badmac) [[unlikely]]
+    {
+      finish(std::string());
+      return;
+    }
+
+    uint32_t attsize = item->frame->attachmentSize();
+    if (attsize > 0 &&
+        (item->frame->frameType() == BackupFrame::FRAMETYPE::ATTACHMENT ||
+         item->frame->frameType() == BackupFrame::FRAMETYPE::AVATAR ||
+         item->frame->frameType() == BackupFrame::FRAMETYPE::STICKER))
+    {
+      if (attsize + filepos > d_filesize) [[unlikely]]
+      {
+        std::ostringstream msg;
+        msg << bepaald::bold_on << "ERROR" << bepaald::bold_off << " Unexpectedly hit end of file while reading attachment!" << std::endl;
+        finish(msg.str());
+        return;
+      }
+
+      uintToFourBytes(iv.get(), counter++);
+      reinterpret_cast<FrameWithAttachment *>(item->frame.get())->setLazyData(iv.get(), d_iv_size, d_mackey, d_mackey_size,
+                                                                              d_cipherkey, d_cipherkey_size, attsize,
+                                                                              d_filename, filepos, d_mappedfile);
+      filepos += attsize + MACSIZE;
+      if (!d_mappedfile)
+        d_file.seekg(filepos, std::ios_base::beg);
+    }
+
+    item->filepos = filepos;
+    item->done = true;
+    pipelinePush(std::move(item), false);
+  }
+}
+
+void FileDecryptor::pipelineWorker()
+{
+  std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
+  EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
+  std::unique_ptr<EVP_MAC_CTX, decltype(&::EVP_MAC_CTX_free)> hctx(EVP_MAC_CTX_new(mac.get()), &::EVP_MAC_CTX_free);
+#else
+  std::unique_ptr<HMAC_CTX, decltype(&::HMAC_CTX_free)> hctx(HMAC_CTX_new(), &::HMAC_CTX_free);
+#endif
+  std::unique_ptr<unsigned char[]> iv(new unsigned char[d_iv_size]);
+  std::memcpy(iv.get(), d_iv, d_iv_size);
+
+  while (true)
+  {
+    PipelineItem *item = nullptr;
+    {
+      std::unique_lock<std::mutex> lock(d_pipelinemutex);
+      d_workavailable.wait(lock, [this]() { return d_pipelinestop || !d_workqueue.empty(); });
+      if (d_pipelinestop)
+        return;
+      item = d_workqueue.front();
+      d_workqueue.pop_front();
+    }
+
+    if (!pipelineProcess(item, iv.get(), ctx.get(), hctx.get())) [[unlikely]]
+      item->frame.reset();
+
+    {
+      std::lock_guard<std::mutex> lock(d_pipelinemutex);
+      item->done = true;
+    }
+    d_resultavailable.notify_one();
+  }
+}
+
+// verify, decrypt and parse a single frame. Only reads the (immutable) keys
+// of this decryptor, so it is safe to call from multiple threads.
+bool FileDecryptor::pipelineProcess(PipelineItem *item, unsigned char *iv, EVP_CIPHER_CTX *ctx,
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+                                    EVP_MAC_CTX *hctx
+#else
+                                    HMAC_CTX *hctx
+#endif
+                                    ) const
+{
+  // the MAC covers the encrypted frame length and the encrypted frame
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  char digest[] = "SHA256";
+  OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string("digest", digest, 0), OSSL_PARAM_construct_end()};
+  if (EVP_MAC_init(hctx, d_mackey, d_mackey_size, params) != 1 ||
+      EVP_MAC_update(hctx, item->encrypted, item->datalength - MACSIZE) != 1) [[unlikely]]
+#else
+  if (HMAC_Init_ex(hctx, d_mackey, d_mackey_size, EVP_sha256(), nullptr) != 1 ||
+      HMAC_Update(hctx, item->encrypted, item->datalength - MACSIZE) != 1) [[unlikely]]
+#endif
+  {
+    item->message += "Failed to update HMAC\n";
+    return false;
+  }
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  unsigned long int digest_size = SHA256_DIGEST_LENGTH;
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  if (EVP_MAC_final(hctx, hash, nullptr, digest_size) != 1) [[unlikely]]
+#else
+  unsigned int digest_size = SHA256_DIGEST_LENGTH;
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  if (HMAC_Final(hctx, hash, &digest_size) != 1) [[unlikely]]
+#endif
+  {
+    item->message += "Failed to finalize MAC\n";
+    return false;
+  }
+
+  unsigned char const *theirmac = item->encrypted + (item->datalength - MACSIZE);
+  if (std::memcmp(theirmac, hash, MACSIZE) != 0) [[unlikely]]
+  {
+    std::ostringstream msg;
+    msg << std::endl;
+    msg << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Bad MAC in frame: theirMac: "
+        << bepaald::bytesToHexString(theirmac, MACSIZE) << std::endl;
+    msg << "                              ourMac: " << bepaald::bytesToHexString(hash, SHA256_DIGEST_LENGTH) << std::endl;
+    if (item->framecount == 1)
+      msg << bepaald::bold_on << " *** NOTE : IT IS LIKELY AN INCORRECT PASSPHRASE WAS PROVIDED ***" << bepaald::bold_off << std::endl;
+    item->message += msg.str();
+    item->badmac = true;
+    return true;
+  }
+
+  // decrypt, starting at the frame length to keep the keystream aligned
+  uintToFourBytes(iv, item->counter);
+  if (EVP_DecryptInit_ex(ctx, EVP_aes_256_ctr(), nullptr, d_cipherkey, iv) != 1) [[unlikely]]
+  {
+    item->message += "CTX INIT FAILED\n";
+    return false;
+  }
+
+  int decodedlength = item->datalength - MACSIZE;
+  std::unique_ptr<unsigned char[]> decoded(new unsigned char[decodedlength]);
+  if (EVP_DecryptUpdate(ctx, decoded.get(), &decodedlength, item->encrypted, item->datalength - MACSIZE) != 1) [[unlikely]]
+  {
+    item->message += "Failed to decrypt data\n";
+    return false;
+  }
+  item->data.reset(); // free up already....
+  item->encrypted = nullptr;
+
+  unsigned int const offset = sizeof(uint32_t);
+  item->frame.reset(initBackupFrame(decoded.get() + offset, decodedlength - offset, item->framecount));
+  if (!item->frame) [[unlikely]]
+  {
+    item->message += "Failed to get valid frame from decoded data...\n"
+      "Data was verified ok, but does not represent a valid frame... Don't know what happened, but it's bad... :(\n"
+      "Decrypted frame data: " + bepaald::bytesToHexString(decoded.get() + offset, decodedlength - offset) + "\n";
+    item->frame = std::make_unique<InvalidFrame>();
+  }
+  return true;
+}
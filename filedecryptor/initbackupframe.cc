@@ -19,7 +19,7 @@
 
 #include "filedecryptor.ih"
 
-BackupFrame *FileDecryptor::initBackupFrame(unsigned char *data, size_t length, uint64_t count) const
+BackupFrame *FileDecryptor::initBackupFrame(unsigned char *data, size_t length, uint64_t count) // static
 {
   if (length < 1) [[unlikely]]
   {
@@ -0,0 +1,65 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+/*
+  Prepares d_framectx and d_framehctx for the next frame (at the current d_iv). The
+  contexts are only allocated (and the cipher and digest only fetched) the first time,
+  after that only key and iv are set on the existing objects. Prints what failed on error.
+*/
+bool FileDecryptor::initFrameContexts()
+{
+  bool newctx = !d_framectx;
+  if (newctx) [[unlikely]]
+    d_framectx = EVP_CIPHER_CTX_new();
+  if (!d_framectx ||
+      EVP_DecryptInit_ex(d_framectx, newctx ? EVP_aes_256_ctr() : nullptr, nullptr, d_cipherkey, d_iv) != 1) [[unlikely]]
+  {
+    std::cout << "CTX INIT FAILED" << std::endl;
+    return false;
+  }
+
+  // disable padding
+  if (newctx) [[unlikely]]
+    EVP_CIPHER_CTX_set_padding(d_framectx, 0);
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  bool newhctx = !d_framehctx;
+  if (newhctx) [[unlikely]]
+  {
+    std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
+    d_framehctx = EVP_MAC_CTX_new(mac.get());
+  }
+  char digest[] = "SHA256";
+  OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string("digest", digest, 0), OSSL_PARAM_construct_end()};
+  if (!d_framehctx ||
+      EVP_MAC_init(d_framehctx, d_mackey, d_mackey_size, newhctx ? params : nullptr) != 1) [[unlikely]]
+#else
+  if (!d_framehctx) [[unlikely]]
+    d_framehctx = HMAC_CTX_new();
+  if (!d_framehctx ||
+      HMAC_Init_ex(d_framehctx, d_mackey, d_mackey_size, EVP_sha256(), nullptr) != 1) [[unlikely]]
+#endif
+  {
+    std::cout << "Failed to initialize HMAC context" << std::endl;
+    return false;
+  }
+  return true;
+}
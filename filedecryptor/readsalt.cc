@@ -0,0 +1,47 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "filedecryptor.ih"
+
+/*
+  Only reads the (unencrypted) HeaderFrame of a backup file, to get the salt
+  needed for deriving its key. Returns an empty vector on any failure.
+*/
+std::vector<unsigned char> FileDecryptor::readSalt(std::string const &filename) // static
+{
+  std::ifstream file(filename, std::ios_base::binary | std::ios_base::in);
+  uint32_t headerlength = 0;
+  if (!file.is_open() || !file.read(reinterpret_cast<char *>(&headerlength), sizeof(decltype(headerlength))))
+    return std::vector<unsigned char>();
+  headerlength = bepaald::swap_endian<uint32_t>(headerlength);
+  if (headerlength == 0 || headerlength > 1024) // a HeaderFrame is tiny, this is not a backup file
+    return std::vector<unsigned char>();
+
+  std::unique_ptr<unsigned char[]> headerdata(new unsigned char[headerlength]);
+  if (!file.read(reinterpret_cast<char *>(headerdata.get()), headerlength))
+    return std::vector<unsigned char>();
+
+  std::unique_ptr<BackupFrame> headerframe(initBackupFrame(headerdata.get(), headerlength));
+  if (!headerframe || headerframe->frameType() != BackupFrame::FRAMETYPE::HEADER ||
+      !reinterpret_cast<HeaderFrame *>(headerframe.get())->salt())
+    return std::vector<unsigned char>();
+
+  HeaderFrame *hf = reinterpret_cast<HeaderFrame *>(headerframe.get());
+  return std::vector<unsigned char>(hf->salt(), hf->salt() + hf->salt_length());
+}
@@ -27,70 +27,115 @@ std::pair<unsigned char *, uint64_t> FileEncryptor::encryptAttachment(unsigned c
   if (d_verbose) [[unlikely]]
     std::cout << "Encrypting attachment. Length: " << length << "..." << std::flush;
 
+  std::unique_ptr<unsigned char[]> encryptedframe(new unsigned char[length + MACSIZE]);
+  if (!encryptAttachmentInit() ||
+      !encryptAttachmentUpdate(data, length, encryptedframe.get()) ||
+      !encryptAttachmentFinal(encryptedframe.get() + length))
+    return {nullptr, 0};
+
+  if (d_verbose) [[unlikely]]
+     std::cout << "done!" << std::endl;
+
+  return {encryptedframe.release(), length + MACSIZE};
+}
+
+/*
+  Encrypting an attachment in parts: encryptAttachmentInit() starts a new attachment (updating the iv),
+  encryptAttachmentUpdate() encrypts the next 'length' bytes of it into 'encrypted' (which must hold
+  'length' bytes) and encryptAttachmentFinal() writes the MACSIZE bytes of mac to 'mac'. The contexts
+  are kept and reused for the next attachment.
+*/
+bool FileEncryptor::encryptAttachmentInit()
+{
+  if (!d_ok)
+    return false;
+
   // update iv:
   uintToFourBytes(d_iv, d_counter++);
 
   // encryption context
-  std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
+  if (!d_attachmentctx)
+    d_attachmentctx = EVP_CIPHER_CTX_new();
+  else
+    EVP_CIPHER_CTX_reset(d_attachmentctx);
 
   // disable padding
-  EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
+  EVP_CIPHER_CTX_set_padding(d_attachmentctx, 0);
 
-  if (EVP_EncryptInit_ex(ctx.get(), EVP_aes_256_ctr(), nullptr, d_cipherkey, d_iv) != 1)
+  if (EVP_EncryptInit_ex(d_attachmentctx, EVP_aes_256_ctr(), nullptr, d_cipherkey, d_iv) != 1)
   {
     std::cout << "CTX INIT FAILED" << std::endl;
-    return {nullptr, 0};
+    return false;
   }
 
-  std::unique_ptr<unsigned char[]> encryptedframe(new unsigned char[length + MACSIZE]);
-  int l = static_cast<int>(length);
-  if (EVP_EncryptUpdate(ctx.get(), encryptedframe.get(), &l, data, length) != 1)
+  // mac context
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  if (!d_attachmenthctx)
   {
-    std::cout << "ENCRYPT FAILED" << std::endl;
-    return {nullptr, 0};
+    std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
+    d_attachmenthctx = EVP_MAC_CTX_new(mac.get());
   }
-
-  // calc mac
-#if OPENSSL_VERSION_NUMBER >= 0x30000000L
-  unsigned long int digest_size = SHA256_DIGEST_LENGTH;
-  unsigned char hash[SHA256_DIGEST_LENGTH];
-  std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
-  std::unique_ptr<EVP_MAC_CTX, decltype(&::EVP_MAC_CTX_free)> hctx(EVP_MAC_CTX_new(mac.get()), &::EVP_MAC_CTX_free);
   char digest[] = "SHA256";
   OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string("digest", digest, 0), OSSL_PARAM_construct_end()};
-  if (EVP_MAC_init(hctx.get(), d_mackey, d_mackey_size, params) != 1)
+  if (EVP_MAC_init(d_attachmenthctx, d_mackey, d_mackey_size, params) != 1)
   {
     std::cout << "Failed to initialize HMAC" << std::endl;
-    return {nullptr, 0};
-  }
-  if (EVP_MAC_update(hctx.get(), d_iv, d_iv_size) != 1 ||
-      EVP_MAC_update(hctx.get(), encryptedframe.get(), length) != 1 ||
-      EVP_MAC_final(hctx.get(), hash, nullptr, digest_size) != 1)
-  {
-    std::cout << "Failed to update/finalize hmac" << std::endl;
-    return {nullptr, 0};
+    return false;
   }
+  if (EVP_MAC_update(d_attachmenthctx, d_iv, d_iv_size) != 1)
 #else
-  unsigned int digest_size = SHA256_DIGEST_LENGTH;
-  unsigned char hash[SHA256_DIGEST_LENGTH];
-  std::unique_ptr<HMAC_CTX, decltype(&::HMAC_CTX_free)> hctx(HMAC_CTX_new(), &::HMAC_CTX_free);
-  if (HMAC_Init_ex(hctx.get(), d_mackey, d_mackey_size, EVP_sha256(), nullptr) != 1)
+  if (!d_attachmenthctx)
+    d_attachmenthctx = HMAC_CTX_new();
+  if (HMAC_Init_ex(d_attachmenthctx, d_mackey, d_mackey_size, EVP_sha256(), nullptr) != 1)
   {
     std::cout << "Failed to initialize HMAC context" << std::endl;
-    return {nullptr, 0};
+    return false;
   }
-  if (HMAC_Update(hctx.get(), d_iv, d_iv_size) != 1 ||
-      HMAC_Update(hctx.get(), encryptedframe.get(), length) != 1 ||
-      HMAC_Final(hctx.get(), hash, &digest_size) != 1)
+  if (HMAC_Update(d_attachmenthctx, d_iv, d_iv_size) != 1)
+#endif
   {
-    std::cout << "Failed to update/finalize hmac" << std::endl;
-    return {nullptr, 0};
+    std::cout << "Failed to update hmac" << std::endl;
+    return false;
   }
-#endif
-  std::memcpy(encryptedframe.get() + length, hash, 10);
+  return true;
+}
 
-  if (d_verbose) [[unlikely]]
-     std::cout << "done!" << std::endl;
+bool FileEncryptor::encryptAttachmentUpdate(unsigned char const *data, uint64_t length, unsigned char *encrypted)
+{
+  int l = static_cast<int>(length);
+  if (EVP_EncryptUpdate(d_attachmentctx, encrypted, &l, data, length) != 1)
+  {
+    std::cout << "ENCRYPT FAILED" << std::endl;
+    return false;
+  }
 
-  return {encryptedframe.release(), length + MACSIZE};
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  if (EVP_MAC_update(d_attachmenthctx, encrypted, length) != 1)
+#else
+  if (HMAC_Update(d_attachmenthctx, encrypted, length) != 1)
+#endif
+  {
+    std::cout << "Failed to update hmac" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool FileEncryptor::encryptAttachmentFinal(unsigned char *mac)
+{
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  unsigned long int digest_size = SHA256_DIGEST_LENGTH;
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  if (EVP_MAC_final(d_attachmenthctx, hash, nullptr, digest_size) != 1)
+#else
+  unsigned int digest_size = SHA256_DIGEST_LENGTH;
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  if (HMAC_Final(d_attachmenthctx, hash, &digest_size) != 1)
+#endif
+  {
+    std::cout << "Failed to finalize hmac" << std::endl;
+    return false;
+  }
+  std::memcpy(mac, hash, MACSIZE);
+  return true;
 }
@@ -19,12 +19,16 @@
 
 #include "fileencryptor.ih"
 
-std::pair<unsigned char *, uint64_t> FileEncryptor::encryptFrame(std::pair<unsigned char *, uint64_t> const &data)
+std::pair<unsigned char const *, uint64_t> FileEncryptor::encryptFrame(std::pair<unsigned char *, uint64_t> const &data)
 {
   return encryptFrame(data.first, data.second);
 }
 
-std::pair<unsigned char *, uint64_t> FileEncryptor::encryptFrame(unsigned char *data, uint64_t length)
+/*
+  Returns the encrypted frame (length + data + mac). The returned data is owned by the
+  encryptor and stays valid until the next call to encryptFrame().
+*/
+std::pair<unsigned char const *, uint64_t> FileEncryptor::encryptFrame(unsigned char *data, uint64_t length)
 {
   if (!d_ok)
     return {nullptr, 0};
@@ -32,19 +36,57 @@ std::pair<unsigned char *, uint64_t> FileEncryptor::encryptFrame(unsigned char *
   // update iv:
   uintToFourBytes(d_iv, d_counter++);
 
-  // encryption context
-  std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> ctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
+  // encryption context, the cipher is only set up the first time, after that
+  // only the key and iv are (re)set
+  bool newctx = !d_framectx;
+  if (newctx) [[unlikely]]
+  {
+    d_framectx = EVP_CIPHER_CTX_new();
+    if (!d_framectx)
+    {
+      std::cout << "CTX INIT FAILED" << std::endl;
+      return {nullptr, 0};
+    }
+  }
+
+  if (EVP_EncryptInit_ex(d_framectx, newctx ? EVP_aes_256_ctr() : nullptr, nullptr, d_cipherkey, d_iv) != 1)
+  {
+    std::cout << "CTX INIT FAILED" << std::endl;
+    return {nullptr, 0};
+  }
 
   // disable padding
-  EVP_CIPHER_CTX_set_padding(ctx.get(), 0);
+  if (newctx) [[unlikely]]
+    EVP_CIPHER_CTX_set_padding(d_framectx, 0);
 
-  if (EVP_EncryptInit_ex(ctx.get(), EVP_aes_256_ctr(), nullptr, d_cipherkey, d_iv) != 1)
+  // mac context, likewise the digest is only set the first time
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  bool newhctx = !d_framehctx;
+  if (newhctx) [[unlikely]]
   {
-    std::cout << "CTX INIT FAILED" << std::endl;
+    std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
+    d_framehctx = EVP_MAC_CTX_new(mac.get());
+  }
+  char digest[] = "SHA256";
+  OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string("digest", digest, 0), OSSL_PARAM_construct_end()};
+  if (!d_framehctx || EVP_MAC_init(d_framehctx, d_mackey, d_mackey_size, newhctx ? params : nullptr) != 1)
+#else
+  if (!d_framehctx) [[unlikely]]
+    d_framehctx = HMAC_CTX_new();
+  if (!d_framehctx || HMAC_Init_ex(d_framehctx, d_mackey, d_mackey_size, EVP_sha256(), nullptr) != 1)
+#endif
+  {
+    std::cout << "Failed to initialize HMAC context" << std::endl;
     return {nullptr, 0};
   }
 
-  std::unique_ptr<unsigned char[]> encryptedframe(new unsigned char[sizeof(uint32_t) + length + MACSIZE]);
+  // output buffer, only grows
+  if (sizeof(uint32_t) + length + MACSIZE > d_framebuffer_size) [[unlikely]]
+  {
+    d_framebuffer_size = sizeof(uint32_t) + length + MACSIZE;
+    d_framebuffer.reset(new unsigned char[d_framebuffer_size]);
+  }
+  unsigned char *encryptedframe = d_framebuffer.get();
 
   int encryptedframepos = 0;
   // in newer backup file versions, the length is encrypted
@@ -56,7 +98,7 @@ std::pair<unsigned char *, uint64_t> FileEncryptor::encryptFrame(unsigned char *
     if (d_verbose) [[unlikely]]
       std::cout << "Encrypting frame. Length: " << length << ", +macsize: " << (length + MACSIZE) << ", swap_endian: " << length_data << " -> " << std::flush;
 
-    if (EVP_EncryptUpdate(ctx.get(), encryptedframe.get(), &l, reinterpret_cast<unsigned char *>(&length_data), sizeof(uint32_t)) != 1)
+    if (EVP_EncryptUpdate(d_framectx, encryptedframe, &l, reinterpret_cast<unsigned char *>(&length_data), sizeof(uint32_t)) != 1)
     {
       std::cout << "ENCRYPT FAILED" << std::endl;
       return {nullptr, 0};
@@ -64,34 +106,45 @@ std::pair<unsigned char *, uint64_t> FileEncryptor::encryptFrame(unsigned char *
     encryptedframepos = l;
 
     if (d_verbose) [[unlikely]]
-      std::cout << bepaald::bytesToHexString(reinterpret_cast<unsigned char *>(encryptedframe.get()), 4) << std::endl;
+      std::cout << bepaald::bytesToHexString(encryptedframe, 4) << std::endl;
   }
   else [[unlikely]] // old backup file format, had RAW frame length
   {
     uint32_t rawlength = bepaald::swap_endian<uint32_t>(length + MACSIZE);
     if (d_verbose) [[unlikely]]
       std::cout << "Writing raw framelength: " << length << ", +macsize: " << (length + MACSIZE) << ", swap_endian: " << rawlength << std::endl;
-    std::memcpy(encryptedframe.get(), reinterpret_cast<unsigned char *>(&rawlength), sizeof(uint32_t));
+    std::memcpy(encryptedframe, reinterpret_cast<unsigned char *>(&rawlength), sizeof(uint32_t));
     encryptedframepos = 4;
   }
 
   int l = static_cast<int>(length);
-  if (EVP_EncryptUpdate(ctx.get(), encryptedframe.get() + encryptedframepos, &l, data, length) != 1)
+  if (EVP_EncryptUpdate(d_framectx, encryptedframe + encryptedframepos, &l, data, length) != 1)
   {
     std::cout << "ENCRYPT FAILED" << std::endl;
     return {nullptr, 0};
   }
 
   // calc mac
+  unsigned char const *macdata = encryptedframe + (d_backupfileversion >= 1 ? 0 : sizeof(uint32_t));
+  uint64_t macdata_size = length + (d_backupfileversion >= 1 ? sizeof(uint32_t) : 0);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  unsigned long int digest_size = SHA256_DIGEST_LENGTH;
+  unsigned char hash[SHA256_DIGEST_LENGTH];
+  if (EVP_MAC_update(d_framehctx, macdata, macdata_size) != 1 ||
+      EVP_MAC_final(d_framehctx, hash, nullptr, digest_size) != 1)
+#else
   unsigned int digest_size = SHA256_DIGEST_LENGTH;
   unsigned char hash[SHA256_DIGEST_LENGTH];
-  HMAC(EVP_sha256(), d_mackey, d_mackey_size,
-       encryptedframe.get() + (d_backupfileversion >= 1 ? 0 : sizeof(uint32_t)),
-       length + (d_backupfileversion >= 1 ? sizeof(uint32_t) : 0),
-       hash, &digest_size);
-  std::memcpy(encryptedframe.get() + sizeof(uint32_t) + length, hash, 10);
+  if (HMAC_Update(d_framehctx, macdata, macdata_size) != 1 ||
+      HMAC_Final(d_framehctx, hash, &digest_size) != 1)
+#endif
+  {
+    std::cout << "Failed to calculate hmac" << std::endl;
+    return {nullptr, 0};
+  }
+  std::memcpy(encryptedframe + sizeof(uint32_t) + length, hash, MACSIZE);
 
   //std::cout << "                                   : " << bepaald::bytesToHexString(hash, digest_size) << std::endl;
 
-  return {encryptedframe.release(), sizeof(uint32_t) + length + MACSIZE};
+  return {encryptedframe, sizeof(uint32_t) + length + MACSIZE};
 }
@@ -23,7 +23,12 @@ FileEncryptor::FileEncryptor(std::string const &passphrase, unsigned char *salt,
   :
   d_passphrase(passphrase),
   d_backupfileversion(backupfileversion),
-  d_verbose(verbose)
+  d_verbose(verbose),
+  d_attachmentctx(nullptr),
+  d_attachmenthctx(nullptr),
+  d_framectx(nullptr),
+  d_framehctx(nullptr),
+  d_framebuffer_size(0)
 {
   d_ok = init(salt, salt_size, iv, iv_size);
 }
@@ -32,12 +37,36 @@ FileEncryptor::FileEncryptor(std::string const &passphrase, uint32_t backupfilev
   :
   d_passphrase(passphrase),
   d_backupfileversion(backupfileversion),
-  d_verbose(verbose)
+  d_verbose(verbose),
+  d_attachmentctx(nullptr),
+  d_attachmenthctx(nullptr),
+  d_framectx(nullptr),
+  d_framehctx(nullptr),
+  d_framebuffer_size(0)
 {}
 
 FileEncryptor::FileEncryptor()
+  :
+  d_attachmentctx(nullptr),
+  d_attachmenthctx(nullptr),
+  d_framectx(nullptr),
+  d_framehctx(nullptr),
+  d_framebuffer_size(0)
 {}
 
+FileEncryptor::~FileEncryptor()
+{
+  EVP_CIPHER_CTX_free(d_attachmentctx);
+  EVP_CIPHER_CTX_free(d_framectx);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  EVP_MAC_CTX_free(d_attachmenthctx);
+  EVP_MAC_CTX_free(d_framehctx);
+#else
+  HMAC_CTX_free(d_attachmenthctx);
+  HMAC_CTX_free(d_framehctx);
+#endif
+}
+
 bool FileEncryptor::init(std::string const &passphrase, unsigned char *salt, uint64_t salt_size, unsigned char *iv, uint64_t iv_size, uint32_t backupfileversion, bool verbose)
 {
   d_passphrase = passphrase;
@@ -21,8 +21,12 @@
 #define FILEENCRYPTOR_H_
 
 #include <cstring>
+#include <memory>
 #include <utility>
 
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+
 #include "../cryptbase/cryptbase.h"
 #include "../common_be.h"
 
@@ -31,20 +35,56 @@ class FileEncryptor : public CryptBase
   std::string d_passphrase;
   uint32_t d_backupfileversion;
   bool d_verbose;
+
+  // state of the attachment currently being encrypted (encryptAttachmentInit/Update/Final)
+  EVP_CIPHER_CTX *d_attachmentctx;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  EVP_MAC_CTX *d_attachmenthctx;
+#else
+  HMAC_CTX *d_attachmenthctx;
+#endif
+
+  // contexts and output buffer for encryptFrame(), created once and reused for every frame
+  EVP_CIPHER_CTX *d_framectx;
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  EVP_MAC_CTX *d_framehctx;
+#else
+  HMAC_CTX *d_framehctx;
+#endif
+  std::unique_ptr<unsigned char[]> d_framebuffer;
+  uint64_t d_framebuffer_size;
+
  public:
+  using CryptBase::MACSIZE;
   FileEncryptor(std::string const &passphrase, unsigned char *salt, uint64_t salt_size, unsigned char *iv, uint64_t iv_size, uint32_t backupfileversion, bool verbose);
   explicit FileEncryptor(std::string const &passphrase, uint32_t backupfileversion, bool verbose);
   FileEncryptor();
   FileEncryptor(FileEncryptor const &other) = delete;
   FileEncryptor operator=(FileEncryptor const &other) = delete;
+  ~FileEncryptor();
   bool init(std::string const &passphrase, unsigned char *salt, uint64_t salt_size, unsigned char *iv, uint64_t iv_size, uint32_t backupfileversion, bool verbose);
   bool init(unsigned char *salt, uint64_t salt_size, unsigned char *iv, uint64_t iv_size);
-  std::pair<unsigned char *, uint64_t> encryptFrame(std::pair<unsigned char *, uint64_t> const &data);
-  std::pair<unsigned char *, uint64_t> encryptFrame(unsigned char *data, uint64_t length);
+  std::pair<unsigned char const *, uint64_t> encryptFrame(std::pair<unsigned char *, uint64_t> const &data);
+  std::pair<unsigned char const *, uint64_t> encryptFrame(unsigned char *data, uint64_t length);
   std::pair<unsigned char *, uint64_t> encryptAttachment(unsigned char *data, uint64_t length);
+  bool encryptAttachmentInit();
+  bool encryptAttachmentUpdate(unsigned char const *data, uint64_t length, unsigned char *encrypted);
+  bool encryptAttachmentFinal(unsigned char *mac);
+  inline uint64_t counter() const;
+  inline void setCounter(uint64_t counter);
  private:
   //bool getCipherAndMac(uint hashoutputsize, uint outputsize); // MOVE TO BASE
   //bool getBackupKey(std::string const &passphrase);           // MOVE TO BASE
 };
 
+inline uint64_t FileEncryptor::counter() const
+{
+  return d_counter;
+}
+
+inline void FileEncryptor::setCounter(uint64_t counter)
+{
+  d_counter = counter;
+}
+
 #endif
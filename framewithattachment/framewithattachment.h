@@ -23,8 +23,10 @@
 #include <cstring>
 #include <memory>
 #include <fstream>
+#include <functional>
 
 #include "../backupframe/backupframe.h"
+#include "../mappedfile/mappedfile.h"
 
 class FrameWithAttachment : public BackupFrame
 {
@@ -39,6 +41,7 @@ class FrameWithAttachment : public BackupFrame
   uint64_t d_cipherkey_size;
   unsigned char *d_cipherkey;
   std::string d_filename;
+  std::shared_ptr<MappedFile> d_mappedfile; // if set, attachment data is read from here instead of d_filename
 
   //BaseDecryptor *d_dec; // DONT OWN THIS!
  public:
@@ -61,10 +64,13 @@ class FrameWithAttachment : public BackupFrame
   inline unsigned char *cipherkey() const;
   inline uint64_t cipherkey_size() const;
   inline std::string const &filename() const;
-  inline void setLazyData(unsigned char *iv, uint32_t iv_size, unsigned char *mackey, uint64_t mackey_size, unsigned char *cipherkey, uint64_t cipherkey_size, uint32_t attsize, std::string const &filename, uint64_t filepos);
+  inline MappedFile const *mappedFile() const;
+  inline void setLazyData(unsigned char *iv, uint32_t iv_size, unsigned char *mackey, uint64_t mackey_size, unsigned char *cipherkey, uint64_t cipherkey_size, uint32_t attsize, std::string const &filename, uint64_t filepos, std::shared_ptr<MappedFile> const &mappedfile = std::shared_ptr<MappedFile>());
   inline void setLazyDataRAW(uint32_t attsize, std::string const &filename);
   //inline virtual void setLazyData(unsigned char *iv, uint32_t iv_size, uint32_t attsize, uint64_t filepos, BaseDecryptor *dec);
   inline unsigned char *attachmentData(bool *badmac = nullptr);
+  inline int streamAttachmentData(std::function<bool(unsigned char const *, uint32_t)> const &chunkhandler);
+  inline bool writeAttachmentData(std::ostream &out);
   inline void clearData();
 };
 
@@ -110,7 +116,8 @@ inline FrameWithAttachment::FrameWithAttachment(FrameWithAttachment &&other)
   d_mackey(std::move(other.d_mackey)),
   d_cipherkey_size(std::move(other.d_cipherkey_size)),
   d_cipherkey(std::move(other.d_cipherkey)),
-  d_filename(std::move(other.d_filename))
+  d_filename(std::move(other.d_filename)),
+  d_mappedfile(std::move(other.d_mappedfile))
 //d_dec(std::move(other.d_dec))
 {
   other.d_attachmentdata = nullptr;
@@ -143,6 +150,8 @@ inline FrameWithAttachment &FrameWithAttachment::operator=(FrameWithAttachment &
     d_mackey = std::move(other.d_mackey);
     d_cipherkey_size = std::move(other.d_cipherkey_size);
     d_cipherkey = std::move(other.d_cipherkey);
+    d_filename = std::move(other.d_filename);
+    d_mappedfile = std::move(other.d_mappedfile);
     //d_dec = std::move(other.d_dec);
 
     other.d_attachmentdata = nullptr;
@@ -169,7 +178,9 @@ inline FrameWithAttachment::FrameWithAttachment(FrameWithAttachment const &other
   d_mackey_size(other.d_mackey_size),
   d_mackey(nullptr),
   d_cipherkey_size(other.d_cipherkey_size),
-  d_cipherkey(nullptr)
+  d_cipherkey(nullptr),
+  d_filename(other.d_filename),
+  d_mappedfile(other.d_mappedfile)
   //d_dec(other.d_dec)
 {
   if (other.d_attachmentdata)
@@ -212,6 +223,8 @@ inline FrameWithAttachment &FrameWithAttachment::operator=(FrameWithAttachment c
     d_mackey_size = other.d_mackey_size;
     d_cipherkey_size = other.d_cipherkey_size;
     d_filepos = other.d_filepos;
+    d_filename = other.d_filename;
+    d_mappedfile = other.d_mappedfile;
     //d_dec = other.d_dec;
 
     if (other.d_attachmentdata)
@@ -294,7 +307,12 @@ inline std::string const &FrameWithAttachment::filename() const
   return d_filename;
 }
 
-inline void FrameWithAttachment::setLazyData(unsigned char *iv, uint32_t iv_size, unsigned char *mackey, uint64_t mackey_size, unsigned char *cipherkey, uint64_t cipherkey_size, uint32_t attsize, std::string const &filename, uint64_t filepos/*, BaseDecryptor *dec*/)
+inline MappedFile const *FrameWithAttachment::mappedFile() const
+{
+  return d_mappedfile.get();
+}
+
+inline void FrameWithAttachment::setLazyData(unsigned char *iv, uint32_t iv_size, unsigned char *mackey, uint64_t mackey_size, unsigned char *cipherkey, uint64_t cipherkey_size, uint32_t attsize, std::string const &filename, uint64_t filepos, std::shared_ptr<MappedFile> const &mappedfile/*, BaseDecryptor *dec*/)
 {
   bepaald::destroyPtr(&d_attachmentdata, &d_attachmentdata_size);
   bepaald::destroyPtr(&d_iv, &d_iv_size);
@@ -326,6 +344,7 @@ inline void FrameWithAttachment::setLazyData(unsigned char *iv, uint32_t iv_size
 
   d_filename = filename;
   d_filepos = filepos;
+  d_mappedfile = mappedfile;
 
   //d_dec = dec;
 }
@@ -357,6 +376,24 @@ inline unsigned char *FrameWithAttachment::attachmentData(bool *badmac)
   return d_attachmentdata;
 }
 
+// passes the attachment data to chunkhandler in parts, without loading all of it,
+// returns 0 on success, 1 on error and -1 on bad mac (see BaseDecryptor::getAttachment())
+inline int FrameWithAttachment::streamAttachmentData(std::function<bool(unsigned char const *, uint32_t)> const &chunkhandler)
+{
+  if (d_attachmentdata)
+    return chunkhandler(d_attachmentdata, d_attachmentdata_size) ? 0 : 1;
+  return BaseDecryptor::getAttachment(this, chunkhandler);
+}
+
+// writes the attachment data to out in parts, returns false on error or bad mac
+inline bool FrameWithAttachment::writeAttachmentData(std::ostream &out)
+{
+  return streamAttachmentData([&out](unsigned char const *data, uint32_t size)
+                              {
+                                return static_cast<bool>(out.write(reinterpret_cast<char const *>(data), size));
+                              }) == 0;
+}
+
 inline void FrameWithAttachment::clearData()
 {
   if (d_attachmentdata) // do not use bepaald::destroyPtr, it will set size to zero
@@ -20,6 +20,7 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <limits>
 
 #include "arg/arg.h"
 #include "common_be.h"
@@ -176,13 +177,53 @@ int main(int argc, char *argv[])
 
   MEMINFO("Start of program, before opening input");
 
+  // backups are kept in memory, unless the user asked otherwise: a database on disk means the
+  // decrypted messages are written to a temporary file, so this is never done by default
+  uint64_t dbondiskthreshold = std::numeric_limits<uint64_t>::max();
+  if (arg.dbondisk())
+    dbondiskthreshold = (arg.dbondiskthreshold() > 0) ? static_cast<uint64_t>(arg.dbondiskthreshold()) * 1024 * 1024 : 0;
+
+  // level of the integrity check done on opening the input (and source)
+  SignalBackup::IntegrityCheck integritycheck = SignalBackup::QUICKCHECK;
+  if (arg.integritycheck() == "none")
+    integritycheck = SignalBackup::NOCHECK;
+  else if (arg.integritycheck() == "foreignkeys")
+    integritycheck = SignalBackup::FOREIGNKEYCHECK;
+  else if (arg.integritycheck() == "full")
+    integritycheck = SignalBackup::FULLCHECK;
+  else if (arg.integritycheck() != "quick")
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Unknown integrity check level: '"
+              << arg.integritycheck() << "'" << std::endl;
+    return 1;
+  }
+
+  // deriving a backup key is slow (on purpose). If more than one key is needed (source and/or
+  // output file), derive them all up front on separate threads and keep them for reuse.
+  {
+    std::vector<std::pair<std::vector<unsigned char>, std::string>> keys;
+    std::vector<unsigned char> inputsalt(FileDecryptor::readSalt(arg.input()));
+    keys.emplace_back(inputsalt, arg.passphrase());
+    if (!arg.output().empty() &&
+        ((bepaald::fileOrDirExists(arg.output()) && !bepaald::isDir(arg.output())) ||
+         (!bepaald::fileOrDirExists(arg.output()) && (arg.output().back() != '/' && arg.output().back() != std::filesystem::path::preferred_separator))))
+      keys.emplace_back(inputsalt, arg.opassphrase().empty() ? arg.passphrase() : arg.opassphrase());
+    if (!arg.source().empty())
+      keys.emplace_back(FileDecryptor::readSalt(arg.source()), arg.sourcepassphrase());
+    if (keys.size() > 1)
+    {
+      CryptBase::enableKeyCache();
+      CryptBase::precomputeBackupKeys(keys);
+    }
+  }
+
   // open input
   if (arg.verbose()) [[unlikely]]
     std::cout << "Opening input" << std::endl;
   std::unique_ptr<SignalBackup> sb(new SignalBackup(arg.input(), arg.passphrase(), arg.verbose(), arg.showprogress(),
                                                     arg.replaceattachments_bool(),
                                                     arg.assumebadframesizeonbadmac(), arg.editattachmentsize(),
-                                                    arg.stoponerror()));
+                                                    arg.stoponerror(), dbondiskthreshold, integritycheck));
   if (!sb->ok())
   {
     std::cout << "Failed to open backup" << std::endl;
@@ -227,7 +268,7 @@ int main(int argc, char *argv[])
       MEMINFO("Before first time reading source");
 
       std::cout << "Requested ALL threads, reading source to get thread list" << std::endl;
-      source.reset(new SignalBackup(arg.source(), arg.sourcepassphrase(), arg.verbose(), arg.showprogress(), !arg.replaceattachments().empty()));
+      source.reset(new SignalBackup(arg.source(), arg.sourcepassphrase(), arg.verbose(), arg.showprogress(), !arg.replaceattachments().empty(), dbondiskthreshold, integritycheck));
       if (!source->ok())
       {
         std::cout << "Error opening source database" << std::endl;
@@ -250,7 +291,7 @@ int main(int argc, char *argv[])
     if (arg.importthreadsbyname().size())
     {
       if (!source)
-        source.reset(new SignalBackup(arg.source(), arg.sourcepassphrase(), arg.verbose(), arg.showprogress(), !arg.replaceattachments().empty()));
+        source.reset(new SignalBackup(arg.source(), arg.sourcepassphrase(), arg.verbose(), arg.showprogress(), !arg.replaceattachments().empty(), dbondiskthreshold, integritycheck));
       if (!source->ok())
       {
         std::cout << "Error opening source database" << std::endl;
@@ -260,30 +301,24 @@ int main(int argc, char *argv[])
         return 1;
     }
 
-    for (uint i = 0; i < threads.size(); ++i)
+    if (threads.size())
     {
-
-      MEMINFO("Before reading source: ", i + 1, "/", threads.size());
-
-      std::cout << std::endl << "Importing thread " << threads[i] << " (" << i + 1 << "/" << threads.size() << ") from source file: " << arg.source() << std::endl;
-      source.reset(new SignalBackup(arg.source(), arg.sourcepassphrase(), arg.verbose(), arg.showprogress(), !arg.replaceattachments().empty()));
-      if (!source->ok())
+      if (!source)
       {
-        std::cout << "Error opening source database" << std::endl;
-        return 1;
+        MEMINFO("Before reading source");
+        std::cout << std::endl << "Reading source file: " << arg.source() << std::endl;
+        source.reset(new SignalBackup(arg.source(), arg.sourcepassphrase(), arg.verbose(), arg.showprogress(), !arg.replaceattachments().empty(), dbondiskthreshold, integritycheck));
+        if (!source->ok())
+        {
+          std::cout << "Error opening source database" << std::endl;
+          return 1;
+        }
+        MEMINFO("After reading source");
       }
       if (!sourcesummarized)
-      {
         source->summarize();
-        sourcesummarized = true;
-      }
-      MEMINFO("After reading source: ", i + 1, "/", threads.size(), " before import");
-      if (!sb->importThread(source.get(), threads[i]))
-      {
-        std::cout << "A fatal error occurred while trying to import thread " << threads[i] << ". Aborting" << std::endl;
+      if (!sb->importThread(source.get(), threads))
         return 1;
-      }
-      MEMINFO("After import");
     }
   }
 
@@ -339,7 +374,7 @@ int main(int argc, char *argv[])
   }
 
   if (!arg.dumpmedia().empty())
-    if (!sb->dumpMedia(arg.dumpmedia(), limittothreads, arg.overwrite()))
+    if (!sb->dumpMedia(arg.dumpmedia(), limittothreads, arg.overwrite(), arg.jobs()))
       return 1;
 
   if (!arg.dumpavatars().empty())
@@ -367,7 +402,7 @@ int main(int argc, char *argv[])
   if (!arg.exporthtml().empty())
     if (!sb->exportHtml(arg.exporthtml(), limittothreads, arg.limittodates(), (arg.split_bool() ? arg.split() : -1),
                         arg.setselfid(), arg.includecalllog(), arg.searchpage(), arg.migratedb(), arg.overwrite(),
-                        arg.append(), arg.light(), arg.themeswitching()))
+                        arg.append(), arg.light(), arg.themeswitching(), arg.jobs()))
       return 1;
 
   if (!arg.exporttxt().empty())
@@ -0,0 +1,64 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "mappedfile.ih"
+
+/*
+  Hints to the kernel about upcoming access to the mapping. These are only
+  hints, failures are ignored. There is no equivalent on windows, where
+  the file was opened with FILE_FLAG_SEQUENTIAL_SCAN instead.
+*/
+
+#if !defined(_WIN32) && !defined(__MINGW64__)
+namespace
+{
+  inline void adviseRange(unsigned char const *data, uint64_t size, uint64_t pos, uint64_t length, int advice)
+  {
+    if (!data || pos >= size || length == 0)
+      return;
+    static uint64_t const pagesize = sysconf(_SC_PAGESIZE);
+    uint64_t start = pos - (pos % pagesize); // must be page aligned
+    length = std::min(length + (pos - start), size - start);
+    madvise(const_cast<unsigned char *>(data) + start, length, advice);
+  }
+}
+#endif
+
+void MappedFile::adviseSequential() const
+{
+#if !defined(_WIN32) && !defined(__MINGW64__)
+  if (d_data)
+    madvise(const_cast<unsigned char *>(d_data), d_size, MADV_SEQUENTIAL);
+#endif
+}
+
+void MappedFile::adviseWillNeed([[maybe_unused]] uint64_t pos, [[maybe_unused]] uint64_t length) const
+{
+#if !defined(_WIN32) && !defined(__MINGW64__)
+  adviseRange(d_data, d_size, pos, length, MADV_WILLNEED);
+#endif
+}
+
+// data in this range will not be read again soon, allow the pages to be dropped
+void MappedFile::adviseDontNeed([[maybe_unused]] uint64_t pos, [[maybe_unused]] uint64_t length) const
+{
+#if !defined(_WIN32) && !defined(__MINGW64__)
+  adviseRange(d_data, d_size, pos, length, MADV_DONTNEED);
+#endif
+}
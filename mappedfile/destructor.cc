@@ -0,0 +1,35 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "mappedfile.ih"
+
+MappedFile::~MappedFile()
+{
+#if !defined(_WIN32) && !defined(__MINGW64__)
+  if (d_data)
+    munmap(const_cast<unsigned char *>(d_data), d_size);
+#else
+  if (d_data)
+    UnmapViewOfFile(d_data);
+  if (d_maphandle)
+    CloseHandle(d_maphandle);
+  if (d_filehandle != INVALID_HANDLE_VALUE)
+    CloseHandle(d_filehandle);
+#endif
+}
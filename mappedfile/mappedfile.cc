@@ -0,0 +1,80 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "mappedfile.ih"
+
+#if !defined(_WIN32) && !defined(__MINGW64__)
+
+MappedFile::MappedFile(std::string const &filename)
+  :
+  d_data(nullptr),
+  d_size(0)
+{
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd == -1)
+    return;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0 ||
+      static_cast<uint64_t>(st.st_size) > static_cast<uint64_t>(SIZE_MAX))
+  {
+    close(fd);
+    return;
+  }
+
+  void *map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd); // the mapping keeps its own reference to the file
+  if (map == MAP_FAILED)
+    return;
+
+  d_data = static_cast<unsigned char const *>(map);
+  d_size = st.st_size;
+}
+
+#else // this is poorly tested, I don't have windows
+
+MappedFile::MappedFile(std::string const &filename)
+  :
+  d_data(nullptr),
+  d_size(0),
+  d_filehandle(INVALID_HANDLE_VALUE),
+  d_maphandle(nullptr)
+{
+  d_filehandle = CreateFile(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+  if (d_filehandle == INVALID_HANDLE_VALUE)
+    return;
+
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(d_filehandle, &size) || size.QuadPart <= 0 ||
+      static_cast<uint64_t>(size.QuadPart) > static_cast<uint64_t>(SIZE_MAX))
+    return;
+
+  d_maphandle = CreateFileMapping(d_filehandle, NULL, PAGE_READONLY, 0, 0, NULL);
+  if (!d_maphandle)
+    return;
+
+  void *map = MapViewOfFile(d_maphandle, FILE_MAP_READ, 0, 0, 0);
+  if (!map)
+    return;
+
+  d_data = static_cast<unsigned char const *>(map);
+  d_size = size.QuadPart;
+}
+
+#endif
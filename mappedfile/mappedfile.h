@@ -0,0 +1,71 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef MAPPEDFILE_H_
+#define MAPPEDFILE_H_
+
+#include <string>
+#include <cstdint>
+
+// read-only memory mapping of an entire file. If mapping fails (or is not
+// supported on the platform), ok() returns false and callers should fall
+// back to regular file io.
+class MappedFile
+{
+  unsigned char const *d_data;
+  uint64_t d_size;
+#if defined(_WIN32) || defined(__MINGW64__)
+  void *d_filehandle;
+  void *d_maphandle;
+#endif
+ public:
+  explicit MappedFile(std::string const &filename);
+  MappedFile(MappedFile const &other) = delete;
+  MappedFile &operator=(MappedFile const &other) = delete;
+  ~MappedFile();
+  inline bool ok() const;
+  inline unsigned char const *data() const;
+  inline uint64_t size() const;
+  inline bool contains(uint64_t pos, uint64_t length) const;
+  void adviseSequential() const;
+  void adviseWillNeed(uint64_t pos, uint64_t length) const;
+  void adviseDontNeed(uint64_t pos, uint64_t length) const;
+};
+
+inline bool MappedFile::ok() const
+{
+  return d_data != nullptr;
+}
+
+inline unsigned char const *MappedFile::data() const
+{
+  return d_data;
+}
+
+inline uint64_t MappedFile::size() const
+{
+  return d_size;
+}
+
+inline bool MappedFile::contains(uint64_t pos, uint64_t length) const
+{
+  return pos <= d_size && length <= d_size - pos;
+}
+
+#endif
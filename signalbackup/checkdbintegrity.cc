@@ -19,11 +19,22 @@
 
 #include "signalbackup.ih"
 
-bool SignalBackup::checkDbIntegrity(bool warn) const
+#include <chrono>
+
+bool SignalBackup::checkDbIntegrity(bool warn, IntegrityCheck level) const
 {
+  if (level == NOCHECK)
+    return true;
+
   SqliteDB::QueryResults results;
 
+  auto elapsed = [](std::chrono::steady_clock::time_point const &start)
+  {
+    return std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()) + "ms";
+  };
+
   // CHECKING FOREIGN KEY CONSTRAINTS
+  auto start = std::chrono::steady_clock::now();
   if (!warn)
     std::cout << "Checking foreign key constraints..." << std::flush;
   d_database.exec("SELECT DISTINCT [table],[parent],[fkid] FROM pragma_foreign_key_check", &results);
@@ -41,7 +52,12 @@ bool SignalBackup::checkDbIntegrity(bool warn) const
     return false;
   }
   if (!warn)
-    std::cout << " ok" << std::endl;
+    std::cout << " ok (" << elapsed(start) << ")" << std::endl;
+  else if (d_verbose) [[unlikely]]
+    std::cout << "Foreign key check passed (" << elapsed(start) << ")" << std::endl;
+
+  if (level == FOREIGNKEYCHECK)
+    return true;
 
   // std::cout << "Checking database integrity (quick)..." << std::flush;
   // d_database.exec("SELECT * FROM pragma_quick_check", &results);
@@ -55,10 +71,12 @@ bool SignalBackup::checkDbIntegrity(bool warn) const
   // std::cout << " ok" << std::endl;
 
   // CHECKING DATABASE
+  std::string const checkname(level == QUICKCHECK ? "quick_check" : "integrity_check");
+  start = std::chrono::steady_clock::now();
   if (!warn)
-    std::cout << "Checking database integrity (full)..." << std::flush;
-  d_database.exec("SELECT * FROM pragma_integrity_check", &results);
-  if (results.rows() && results.valueAsString(0, "integrity_check") != "ok")
+    std::cout << "Checking database integrity (" << (level == QUICKCHECK ? "quick" : "full") << ")..." << std::flush;
+  d_database.exec("SELECT * FROM pragma_" + checkname, &results);
+  if (results.rows() && results.valueAsString(0, checkname) != "ok")
   {
     if (!warn)
       std::cout << std::endl << bepaald::bold_on << "ERROR" << bepaald::bold_off
@@ -72,7 +90,10 @@ bool SignalBackup::checkDbIntegrity(bool warn) const
     return false;
   }
   if (!warn)
-    std::cout << " ok" << std::endl;
+    std::cout << " ok (" << elapsed(start) << ")" << std::endl;
+  else if (d_verbose) [[unlikely]]
+    std::cout << "Database integrity check (" << (level == QUICKCHECK ? "quick" : "full") << ") passed ("
+              << elapsed(start) << ")" << std::endl;
 
   return true;
 }
@@ -0,0 +1,133 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+#include "../autoversion.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+/*
+  Runs the integrity check requested for a freshly opened input. The check is
+  skipped when the same input (identified by d_integritycachekey), opened with
+  the same options that change the loaded database, by the same version of this
+  program, has passed a check of at least this level before. The cache is a
+  plain text file, one '<key> <level>' per line, least recently updated first.
+  Only the last 256 lines are kept.
+*/
+void SignalBackup::checkDbIntegrityOnOpen(IntegrityCheck level, bool replaceattachments, bool assumebadframesizeonbadmac,
+                                          std::vector<long long int> const &editattachments) const
+{
+  if (level == NOCHECK)
+    return;
+
+  uint constexpr maxentries = 256;
+
+  std::string cachekey;
+  if (!d_integritycachekey.empty())
+  {
+    cachekey = d_integritycachekey + ":" + VERSIONDATE + ":" + (replaceattachments ? "r" : "") +
+      (assumebadframesizeonbadmac ? "b" : "");
+    for (uint i = 0; i < editattachments.size(); ++i)
+      cachekey += (i ? "," : "e") + bepaald::toString(editattachments[i]);
+  }
+
+  std::string const cachefile(cachekey.empty() ? std::string() : integrityCacheFile());
+
+  // (re)stores key at the end of the cache, never lowering a level that was stored before
+  auto store = [](std::vector<std::pair<std::string, int>> *cache, std::string const &key, int cachedlevel)
+  {
+    auto it = std::find_if(cache->begin(), cache->end(), [&key](auto const &entry) { return entry.first == key; });
+    if (it != cache->end())
+    {
+      cachedlevel = std::max(it->second, cachedlevel);
+      cache->erase(it);
+    }
+    cache->emplace_back(key, cachedlevel);
+  };
+
+  auto readcache = [&cachefile, &store]()
+  {
+    std::vector<std::pair<std::string, int>> cache;
+    std::ifstream in(cachefile);
+    std::string line;
+    while (std::getline(in, line))
+      if (std::string::size_type sep = line.rfind(' '); sep != std::string::npos && sep != 0)
+        store(&cache, line.substr(0, sep), bepaald::toNumber<int>(line.substr(sep + 1)));
+    return cache;
+  };
+
+  if (!cachefile.empty())
+  {
+    std::vector<std::pair<std::string, int>> cache(readcache());
+    if (auto it = std::find_if(cache.begin(), cache.end(), [&cachekey](auto const &entry) { return entry.first == cachekey; });
+        it != cache.end() && it->second >= level)
+    {
+      if (d_verbose) [[unlikely]]
+        std::cout << "Skipping integrity check: input passed before" << std::endl;
+      return;
+    }
+  }
+
+  if (!checkDbIntegrity(true, level) || cachefile.empty())
+    return;
+
+  // other instances may be updating the cache as well: take a lock (creating a directory is atomic
+  // on every platform) and re-read the cache under it. The new cache is written to a temporary file,
+  // which is then renamed over the old one, so readers never see a partial file. A lock older than
+  // a minute is assumed to be left behind by a crashed instance. The cache is only a cache: if the
+  // lock can not be had, it is simply not updated.
+  std::error_code ec;
+  std::filesystem::create_directories(std::filesystem::path(cachefile).parent_path(), ec);
+  std::string const lockdir(cachefile + ".lock");
+  bool locked = false;
+  for (uint attempt = 0; attempt < 50 && !locked; ++attempt)
+  {
+    if (std::filesystem::create_directory(lockdir, ec))
+      locked = true;
+    else
+    {
+      auto locktime = std::filesystem::last_write_time(lockdir, ec);
+      if (!ec && std::filesystem::file_time_type::clock::now() - locktime > std::chrono::minutes(1))
+        std::filesystem::remove(lockdir, ec);
+      else
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+  }
+  if (!locked)
+    return;
+
+  std::vector<std::pair<std::string, int>> cache(readcache());
+  store(&cache, cachekey, level);
+  std::string const tmpfile(cachefile + ".tmp");
+  bool written = false;
+  {
+    std::ofstream out(tmpfile, std::ios_base::trunc);
+    for (uint i = (cache.size() > maxentries ? cache.size() - maxentries : 0); i < cache.size(); ++i)
+      out << cache[i].first << " " << cache[i].second << '\n';
+    written = out.good();
+  }
+  if (written)
+    std::filesystem::rename(tmpfile, cachefile, ec);
+  if (!written || ec)
+    std::filesystem::remove(tmpfile, ec);
+  std::filesystem::remove(lockdir, ec);
+}
@@ -26,26 +26,16 @@ bool SignalBackup::cleanAttachments()
   std::cout << "  Deleting unused attachments..." << std::endl;
   SqliteDB::QueryResults results;
   d_database.exec("SELECT _id,unique_id FROM part", &results);
+
+  // collect the keys of all remaining parts once, instead of scanning all parts for every attachment
+  std::set<std::pair<uint64_t, uint64_t>> partkeys;
+  for (uint i = 0; i < results.rows(); ++i)
+    if (results.valueHasType<long long int>(i, "_id") && results.valueHasType<long long int>(i, "unique_id"))
+      partkeys.emplace(results.getValueAs<long long int>(i, "_id"), results.getValueAs<long long int>(i, "unique_id"));
+
   for (auto it = d_attachments.begin(); it != d_attachments.end();)
   {
-    bool found = false;
-    for (uint i = 0; i < results.rows(); ++i)
-    {
-      long long int rowid = -1;
-      if (results.valueHasType<long long int>(i, "_id"))
-        rowid = results.getValueAs<long long int>(i, "_id");
-      long long int uniqueid = -1;
-      if (results.valueHasType<long long int>(i, "unique_id"))
-        uniqueid = results.getValueAs<long long int>(i, "unique_id");
-
-      if (rowid != -1 && uniqueid != -1 &&
-          it->first.first == static_cast<uint64_t>(rowid) && it->first.second == static_cast<uint64_t>(uniqueid))
-      {
-        found = true;
-        break;
-      }
-    }
-    if (!found)
+    if (!bepaald::contains(partkeys, it->first))
       it = d_attachments.erase(it);
     else
       ++it;
@@ -25,144 +25,101 @@ void SignalBackup::compactIds(std::string const &table, std::string const &col)
 
   std::cout << "  Compacting table: " << table << " (" << col << ")" << std::endl;
 
-  SqliteDB::QueryResults results;
-  // d_database.exec("SELECT " + col + " FROM " + table, &results);
-  // results.prettyPrint();
+  // The positive ids are renumbered to fill all gaps, starting at the lowest id and keeping
+  // their order (this is what filling the gaps one at a time would result in as well). The
+  // complete old->new mapping is calculated at once and applied with one or two statements
+  // for the table and each linked column.
+  d_database.exec("DROP TABLE IF EXISTS temp.compactids_map");
+  if (!d_database.exec("CREATE TEMP TABLE compactids_map(old INTEGER PRIMARY KEY, new INTEGER NOT NULL)") ||
+      !d_database.exec("INSERT INTO temp.compactids_map SELECT old, new FROM "
+                       "(SELECT old, MIN(old) OVER () + ROW_NUMBER() OVER (ORDER BY old) - 1 AS new "
+                       "FROM (SELECT DISTINCT " + col + " AS old FROM " + table + " WHERE " + col + " > 0)) WHERE old != new"))
+  {
+    std::cout << "ERROR: compacting table '" << table << "'" << std::endl;
+    d_database.exec("DROP TABLE IF EXISTS temp.compactids_map");
+    return;
+  }
+  if (d_database.getSingleResultAs<long long int>("SELECT COUNT(*) FROM temp.compactids_map", 0) == 0)
+  {
+    d_database.exec("DROP TABLE temp.compactids_map");
+    return;
+  }
+
+  // gather the (non-json) columns that need updating
+  std::vector<TableConnection const *> links;
+  std::vector<TableConnection const *> jsonlinks;
+  if (col == "_id") [[likely]]
+    for (auto const &dbl : d_databaselinks)
+    {
+      if ((dbl.flags & SKIP) || table != dbl.table || !d_database.containsTable(dbl.table))
+        continue;
+      for (auto const &c : dbl.connections)
+        if (d_databaseversion >= c.mindbvversion && d_databaseversion <= c.maxdbvversion &&
+            d_database.containsTable(c.table) && d_database.tableContainsColumn(c.table, c.column))
+          (c.json_path.empty() ? links : jsonlinks).push_back(&c);
+    }
 
-  // gets first available _id in table
-  d_database.exec("SELECT t1." + col + "+1 FROM " + table + " t1 LEFT OUTER JOIN " + table + " t2 ON t2." + col + "=t1." + col + "+1 WHERE t2." + col + " IS NULL AND t1." + col + " > 0 ORDER BY t1." + col + " LIMIT 1", &results);
+  // Updating a column in place in one statement could temporarily create a duplicate value (which
+  // fails on UNIQUE columns), so the values to change are first moved above all existing values.
+  long long int offset = d_database.getSingleResultAs<long long int>("SELECT IFNULL(MAX(" + col + "), 0) + 1 FROM " + table, 1);
+  for (auto const *c : links)
+    offset = std::max(offset, d_database.getSingleResultAs<long long int>("SELECT IFNULL(MAX(" + c->column + "), 0) + 1 FROM " + c->table, 1));
 
-  while (results.rows() > 0 && results.valueHasType<long long int>(0, 0))
+  auto remap = [&](std::string const &t, std::string const &c, std::string const &whereclause)
   {
-    long long int nid = results.getValueAs<long long int>(0, 0);
+    std::string where(whereclause.empty() ? "" : " AND " + whereclause);
+    return d_database.exec("UPDATE " + t + " SET " + c + " = " + c + " + ? WHERE " + c + " IN (SELECT old FROM temp.compactids_map)" + where, offset) &&
+      d_database.exec("UPDATE " + t + " SET " + c + " = temp.compactids_map.new FROM temp.compactids_map "
+                      "WHERE " + t + "." + c + " = temp.compactids_map.old + ?" + where, offset);
+  };
+
+  d_database.exec("SAVEPOINT compactids");
+  if (!remap(table, col, std::string()))
+  {
+    std::cout << "ERROR: compacting table '" << table << "'" << std::endl;
+    d_database.exec("ROLLBACK TO compactids");
+    d_database.exec("RELEASE compactids");
+    d_database.exec("DROP TABLE temp.compactids_map");
+    return;
+  }
 
-    d_database.exec("SELECT MIN(" + col + ") FROM " + table + " WHERE " + col + " > ?", nid, &results);
-    if (results.rows() == 0 || !results.valueHasType<long long int>(0, 0))
-      break;
-    long long int valuetochange = results.getValueAs<long long int>(0, 0);
-    //std::cout << "Changing _id : " << valuetochange << " -> " << nid << std::endl;
+  for (auto const *c : links)
+    if (!remap(c->table, c->column, c->whereclause))
+      std::cout << "ERROR: compacting table '" << table << "'" << std::endl;
 
-    d_database.exec("UPDATE " + table + " SET " + col + " = ? WHERE " + col + " = ?", {nid, valuetochange});
+  for (auto const *c : jsonlinks)
+    if (!d_database.exec("UPDATE " + c->table + " SET " + c->column + " = json_replace(" + c->column + ", " + c->json_path + ", temp.compactids_map.new) "
+                         "FROM temp.compactids_map WHERE json_extract(" + c->table + "." + c->column + ", " + c->json_path + ") = temp.compactids_map.old"))
+      std::cout << "ERROR: compacting table '" << table << "'" << std::endl;
+  d_database.exec("RELEASE compactids");
 
-    if (col == "_id") [[likely]]
+  if (col == "_id" && table == "part")
+  {
+    SqliteDB::QueryResults results;
+    d_database.exec("SELECT old, new FROM temp.compactids_map", &results);
+    std::map<uint64_t, uint64_t> newrowids;
+    for (uint i = 0; i < results.rows(); ++i)
+      newrowids.emplace(results.getValueAs<long long int>(i, "old"), results.getValueAs<long long int>(i, "new"));
+
+    // take out all attachments that need a new key first, their new keys may still be in use
+    std::vector<decltype(d_attachments)::node_type> moved;
+    for (auto att = d_attachments.begin(); att != d_attachments.end(); )
     {
-      for (auto const &dbl : d_databaselinks)
-      {
-        if (dbl.flags & SKIP)
-          continue;
-
-        if (!d_database.containsTable(dbl.table)) [[unlikely]]
-          continue;
-
-        if (table == dbl.table)
-        {
-          for (auto const &c : dbl.connections)
-          {
-            if (d_databaseversion >= c.mindbvversion && d_databaseversion <= c.maxdbvversion &&
-                d_database.containsTable(c.table) && d_database.tableContainsColumn(c.table, c.column))
-            {
-              if (!c.json_path.empty())
-              {
-                if (!d_database.exec("UPDATE " + c.table + " SET " + c.column + " = json_replace(" + c.column + ", " + c.json_path + ", ?) "
-                                       "WHERE json_extract(" + c.column + ", " + c.json_path + ") = ?", {nid, valuetochange}))
-                  std::cout << "ERROR: compacting table '" << table << "'" << std::endl;
-              }
-              else if (!d_database.exec("UPDATE " + c.table + " SET " + c.column + " = ? WHERE " + c.column + " = ?" + (c.whereclause.empty() ? "" : " AND " + c.whereclause), {nid, valuetochange}))
-                std::cout << "ERROR: compacting table '" << table << "'" << std::endl;
-            }
-          }
-        }
-      }
-      /*
-      if (table == "sms")
-      {
-        if (d_database.containsTable("msl_message"))
-          d_database.exec("UPDATE msl_message SET message_id = ? WHERE message_id = ? AND is_mms IS NOT 1", {nid, valuetochange});
-
-        if (d_database.containsTable("reaction")) // dbv >= 121
-          d_database.exec("UPDATE reaction SET message_id = ? WHERE message_id = ? AND is_mms IS NOT 1", {nid, valuetochange});
-      }
-      else if (table == d_mms_table)
-      {
-        d_database.exec("UPDATE part SET mid = ? WHERE mid = ?", {nid, valuetochange}); // update part.mid to new mms._id's
-        d_database.exec("UPDATE group_receipts SET mms_id = ? WHERE mms_id = ?", {nid, valuetochange}); //
-        if (d_database.containsTable("mention"))
-          d_database.exec("UPDATE mention SET message_id = ? WHERE message_id = ?", {nid, valuetochange});
-        if (d_database.containsTable("msl_message"))
-          d_database.exec("UPDATE msl_message SET message_id = ? WHERE message_id = ? AND is_mms IS 1", {nid, valuetochange});
-        if (d_database.containsTable("reaction")) // dbv >= 121
-          d_database.exec("UPDATE reaction SET message_id = ? WHERE message_id = ? AND is_mms IS 1", {nid, valuetochange});
-        if (d_database.containsTable("story_sends"))
-          d_database.exec("UPDATE story_sends SET message_id = ? WHERE message_id = ?", {nid, valuetochange});
-      }
-      else */if (table == "part")
-      {
-        for (auto att = d_attachments.begin(); att != d_attachments.end(); )
-        {
-          if (reinterpret_cast<AttachmentFrame *>(att->second.get())->rowId() == static_cast<uint64_t>(valuetochange))
-          {
-            AttachmentFrame *a = reinterpret_cast<AttachmentFrame *>(att->second.release());
-            att = d_attachments.erase(att);
-            a->setRowId(nid);
-            d_attachments.emplace(std::make_pair(a->rowId(), a->attachmentId()), a);
-          }
-          else
-            ++att;
-        }
-
-        /*
-        // update rowid in previews (mms.previews contains a json string referencing the 'rowId' == part._id)
-        if (d_database.tableContainsColumn("mms", "previews"))
-          d_database.exec("UPDATE mms SET previews = json_replace(previews, '$[0].attachmentId.rowId', ?) "
-                          "WHERE json_extract(previews, '$[0].attachmentId.rowId') = ?", {nid, valuetochange});
-        */
-        /*
-        //  REPLACED WITH ABOVE
-
-        // update rowid in previews (mms.previews contains a json string referencing the 'rowId' == part._id)
-        SqliteDB::QueryResults results2;
-        d_database.exec("SELECT _id,previews FROM mms WHERE previews IS NOT NULL", &results2);
-        std::regex rowid_in_json(".*\"rowId\":(" + bepaald::toString(valuetochange) + ")[,}].*");
-        std::smatch sm;
-        for (uint i = 0; i < results2.rows(); ++i)
-        {
-          std::string line = results2.valueAsString(i, "previews");
-          //std::cout << " OLD: " << line << std::endl;
-          if (std::regex_match(line, sm, rowid_in_json))
-            if (sm.size() == 2) // 0 is full match, 1 is first submatch (which is what we want)
-            {
-              //std::cout << "MATCHED:" << std::endl;
-              //std::cout << sm.size() << std::endl;
-              line.replace(sm.position(1), sm.length(1), bepaald::toString(nid));
-              //std::cout << " NEW: " << line << std::endl;
-
-              d_database.exec("UPDATE mms SET previews = ? WHERE _id = ?", {line, results2.getValueAs<long long int>(i, "_id")});
-            }
-        }
-        */
-      }
-      /*
-      else if (table == "msl_payload")
-      {
-        d_database.exec("UPDATE msl_message SET payload_id = ? WHERE payload_id = ?", {nid, valuetochange});
-        d_database.exec("UPDATE msl_recipient SET payload_id = ? WHERE payload_id = ?", {nid, valuetochange});
-      }
-      else if (table == "notification_profile") // should actually be cleared at this point...
-      {
-        d_database.exec("UPDATE notification_profile_allowed_members SET notification_profile_id = ? WHERE notification_profile_id = ?", {nid, valuetochange});
-        d_database.exec("UPDATE notification_profile_schedule SET notification_profile_id = ? WHERE notification_profile_id = ?", {nid, valuetochange});
-      }
-      else if (table == "distribution_list")
-      {
-        d_database.exec("UPDATE recipient SET distribution_list_id = ? WHERE distribution_list_id = ?", {nid, valuetochange});
-        d_database.exec("UPDATE distribution_list_member SET list_id = ? WHERE list_id = ?", {nid, valuetochange});
-      }
-      */
+      if (bepaald::contains(newrowids, att->first.first))
+        moved.emplace_back(d_attachments.extract(att++));
+      else
+        ++att;
+    }
+    for (auto &att : moved)
+    {
+      AttachmentFrame *a = att.mapped().get();
+      a->setRowId(newrowids[a->rowId()]);
+      att.key().first = a->rowId();
+      d_attachments.insert(std::move(att));
     }
-
-    // gets first available _id in table
-    d_database.exec("SELECT t1." + col + "+1 FROM " + table + " t1 LEFT OUTER JOIN " + table + " t2 ON t2." + col + "=t1." + col + "+1 WHERE t2." + col + " IS NULL AND t1." + col + " > 0 ORDER BY t1." + col + " LIMIT 1", &results);
   }
+
+  d_database.exec("DROP TABLE temp.compactids_map");
   // d_database.exec("SELECT _id FROM " + table, &results);
   // results.prettyPrint();
 }
@@ -19,7 +19,11 @@
 
 #include "signalbackup.ih"
 
-bool SignalBackup::dumpMedia(std::string const &dir, std::vector<long long int> const &threads, bool overwrite) const
+#include <atomic>
+#include <thread>
+
+bool SignalBackup::dumpMedia(std::string const &dir, std::vector<long long int> const &threads, bool overwrite,
+                             long long int jobs) const
 {
   std::cout << "Dumping media to dir '" << dir << "'" << std::endl;
 
@@ -71,77 +75,74 @@ bool SignalBackup::dumpMedia(std::string const &dir, std::vector<long long int>
                                                                        // folder already exists, but from another _id,
                                                                        // it is a different thread with the same name
 
-#if __cplusplus > 201703L
-  for (int count = 0; auto const &aframe : d_attachments)
-#else
-    int count = 0;
-  for (auto const &aframe : d_attachments)
-#endif
+  // minimal query, for incomplete database (the info for all attachments is fetched at once)
+  bool fullbackup = false;
+  std::string query = "SELECT part._id, part.unique_id, part.mid, part.ct, part.file_name, part.display_order FROM part";
+  // if all tables for detailed info are present...
+  if (d_database.containsTable(d_mms_table) && d_database.containsTable("thread") &&
+      d_database.containsTable("groups") && d_database.containsTable("recipient"))
+  {
+    fullbackup = true;
+    query = "SELECT part._id, part.unique_id, part.mid, part.ct, part.file_name, part.display_order, " +
+      d_mms_table + ".date_received, " + d_mms_table + "." + d_mms_type + ", " +
+      d_mms_table + ".thread_id, thread." + d_thread_recipient_id +
+      ", COALESCE(groups.title,recipient." + d_recipient_system_joined_name + ", recipient.profile_joined_name, "
+      "recipient." + d_recipient_profile_given_name + ")"
+      " AS 'chatpartner' FROM part "
+      "LEFT JOIN " + d_mms_table + " ON part.mid == " + d_mms_table + "._id "
+      "LEFT JOIN thread ON " + d_mms_table + ".thread_id == thread._id "
+      "LEFT JOIN recipient ON thread." + d_thread_recipient_id + " == recipient._id "
+      "LEFT JOIN groups ON recipient.group_id == groups.group_id";
+  }
+
+  if (!threads.empty())
   {
+    query += " WHERE thread._id IN (";
+    for (uint i = 0; i < threads.size(); ++i)
+      query += bepaald::toString(threads[i]) + ((i == threads.size() - 1) ? ")" : ",");
+  }
 
-    ++count;
-    std::cout << "\33[2K\rSaving attachments...  " << count << "/" << d_attachments.size() << std::flush;
+  SqliteDB::QueryResults results;
+  if (!d_database.exec(query, &results))
+    return false;
+  std::map<std::pair<uint64_t, uint64_t>, std::vector<unsigned int>> attachmentrows; // <rowid,uniqueid> -> rows in results
+  for (uint i = 0; i < results.rows(); ++i)
+    attachmentrows[{results.getValueAs<long long int>(i, "_id"), results.getValueAs<long long int>(i, "unique_id")}].push_back(i);
 
+  // First all filenames are decided (and the files created), in the same order as
+  // before, so they do not depend on the order in which the attachments get written.
+  std::vector<std::tuple<AttachmentFrame *, std::string, long long int>> todo; // frame, file, timestamp
+  for (auto const &aframe : d_attachments)
+  {
     AttachmentFrame *a = aframe.second.get();
 
     //std::cout << "Looking for attachment: " << std::endl;
     //std::cout << "rid: " << a->rowId() << std::endl;
     //std::cout << "uid: " << a->attachmentId() << std::endl;
 
-    SqliteDB::QueryResults results;
-
-    // minimal query, for incomplete database
-    bool fullbackup = false;
-    std::string query = "SELECT part.mid, part.ct, part.file_name, part.display_order FROM part WHERE part._id == ? AND part.unique_id == ?";
-    // if all tables for detailed info are present...
-    if (d_database.containsTable(d_mms_table) && d_database.containsTable("thread") &&
-        d_database.containsTable("groups") && d_database.containsTable("recipient"))
-    {
-      fullbackup = true;
-      query = "SELECT part.mid, part.ct, part.file_name, part.display_order, " +
-        d_mms_table + ".date_received, " + d_mms_table + "." + d_mms_type + ", " +
-        d_mms_table + ".thread_id, thread." + d_thread_recipient_id +
-        ", COALESCE(groups.title,recipient." + d_recipient_system_joined_name + ", recipient.profile_joined_name, "
-        "recipient." + d_recipient_profile_given_name + ")"
-        " AS 'chatpartner' FROM part "
-        "LEFT JOIN " + d_mms_table + " ON part.mid == " + d_mms_table + "._id "
-        "LEFT JOIN thread ON " + d_mms_table + ".thread_id == thread._id "
-        "LEFT JOIN recipient ON thread." + d_thread_recipient_id + " == recipient._id "
-        "LEFT JOIN groups ON recipient.group_id == groups.group_id "
-        "WHERE part._id == ? AND part.unique_id == ?";
-    }
-
-    if (!threads.empty())
-    {
-      query += " AND thread._id IN (";
-      for (uint i = 0; i < threads.size(); ++i)
-        query += bepaald::toString(threads[i]) + ((i == threads.size() - 1) ? ")" : ",");
-    }
+    auto it = attachmentrows.find(aframe.first);
+    unsigned int nrows = (it == attachmentrows.end() ? 0 : it->second.size());
 
-    if (!d_database.exec(query, {static_cast<long long int>(a->rowId()), static_cast<long long int>(a->attachmentId())},  &results))
-      return false;
-
-    //results.prettyPrint();
-
-    if (results.rows() == 0 && !threads.empty()) // probably an attachment for a de-selected thread
+    if (nrows == 0 && !threads.empty()) // probably an attachment for a de-selected thread
       continue;
 
-    if (results.rows() != 1)
+    if (nrows != 1)
     {
-      std::cout << " ERROR Unexpected number of results: " << results.rows()
+      std::cout << " ERROR Unexpected number of results: " << nrows
                 << " (rowid: " << a->rowId() << ", uniqueid: " << a->attachmentId() << ")" << std::endl;
       continue;
     }
+    unsigned int row = it->second[0];
 
     std::string filename;
     long long int datum = a->attachmentId();
 
-    if (fullbackup && !results.isNull(0, "date_received"))
-      datum = results.getValueAs<long long int>(0, "date_received");
-    long long int order = results.getValueAs<long long int>(0, "display_order");
+    if (fullbackup && !results.isNull(row, "date_received"))
+      datum = results.getValueAs<long long int>(row, "date_received");
+    long long int order = results.getValueAs<long long int>(row, "display_order");
 
-    if (!results.isNull(0, "file_name")) // file name IS SET in database
-      filename = sanitizeFilename(results.valueAsString(0, "file_name"));
+    if (!results.isNull(row, "file_name")) // file name IS SET in database
+      filename = sanitizeFilename(results.valueAsString(row, "file_name"));
 
     if (filename.empty()) // filename was not set in database or was not impossible
     {                     // to sanitize (eg reserved name in windows 'COM1')
@@ -152,7 +153,7 @@ bool SignalBackup::dumpMedia(std::string const &dir, std::vector<long long int>
       //tmp << "." << datum % 1000;
 
       // get file ext
-      std::string mime = results.valueAsString(0, "ct");
+      std::string mime = results.valueAsString(row, "ct");
       std::string ext = std::string(mimetypes.getExtension(mime));
       if (ext.empty())
       {
@@ -167,11 +168,11 @@ bool SignalBackup::dumpMedia(std::string const &dir, std::vector<long long int>
 
     // std::cout << "FILENAME: " << filename << std::endl;
     std::string targetdir = dir;
-    if (fullbackup && !results.isNull(0, "thread_id") && !results.isNull(0, "chatpartner")
-        && !results.isNull(0, d_mms_type))
+    if (fullbackup && !results.isNull(row, "thread_id") && !results.isNull(row, "chatpartner")
+        && !results.isNull(row, d_mms_type))
     {
-      long long int tid = results.getValueAs<long long int>(0, "thread_id");
-      std::string chatpartner = sanitizeFilename(results.valueAsString(0, "chatpartner"));
+      long long int tid = results.getValueAs<long long int>(row, "thread_id");
+      std::string chatpartner = sanitizeFilename(results.valueAsString(row, "chatpartner"));
       if (chatpartner.empty())
         chatpartner = "Contact " + bepaald::toString(tid);
 
@@ -208,7 +209,7 @@ bool SignalBackup::dumpMedia(std::string const &dir, std::vector<long long int>
         }
       }
 
-      long long int msg_box = results.getValueAs<long long int>(0, d_mms_type);
+      long long int msg_box = results.getValueAs<long long int>(row, d_mms_type);
       targetdir = dir + "/" + conversations.second[idx_of_thread] + "/" + (Types::isOutgoing(msg_box) ? "sent" : "received");
 
       // create dir if not exists
@@ -252,28 +253,60 @@ bool SignalBackup::dumpMedia(std::string const &dir, std::vector<long long int>
       //std::cout << filename << std::endl;
     }
     */
+    // create the file, so following attachments with the same name get a unique one
     std::ofstream attachmentstream(targetdir + "/" + filename, std::ios_base::binary);
-
     if (!attachmentstream.is_open())
     {
       std::cout << " ERROR Failed to open file for writing: " << targetdir << "/" << filename << std::endl;
       continue;
     }
-    else
-      if (!attachmentstream.write(reinterpret_cast<char *>(a->attachmentData()), a->attachmentSize()))
+    todo.emplace_back(a, targetdir + "/" + filename, datum);
+  }
+
+  // then write the data, possibly by multiple workers at once. Each attachment is
+  // decrypted separately (reading from the memory mapped backup or its own file handle)
+  std::atomic<unsigned int> next(0);
+  std::atomic<unsigned int> count(0);
+  auto worker = [&]()
+  {
+    for (unsigned int idx; (idx = next++) < todo.size();)
+    {
+      auto const &[a, filename, datum] = todo[idx];
+
+      std::cout << "\33[2K\rSaving attachments...  " + bepaald::toString(++count) + "/" + bepaald::toString(todo.size()) << std::flush;
+
+      std::ofstream attachmentstream(filename, std::ios_base::binary);
+      if (!attachmentstream.is_open())
+      {
+        std::cout << " ERROR Failed to open file for writing: " + filename + "\n" << std::flush;
+        continue;
+      }
+      else if (!a->writeAttachmentData(attachmentstream))
       {
-        std::cout << " ERROR Failed to write data to file: " << targetdir << "/" << filename << std::endl;
+        std::cout << " ERROR Failed to write data to file: " + filename + "\n" << std::flush;
         a->clearData();
         continue;
       }
-    attachmentstream.close(); // need to close, or the auto-close will change files mtime again.
-    a->clearData();
+      attachmentstream.close(); // need to close, or the auto-close will change files mtime again.
+      a->clearData();
 
-    setFileTimeStamp(targetdir + "/" + filename, datum); // ignoring return for now...
+      setFileTimeStamp(filename, datum); // ignoring return for now...
 
-    // !! ifdef c++20
-    //std::error_code ec;
-    //std::filesystem::last_write_time(dir + "/" + chatpartner + "/" + filename, std::chrono::clock_cast<std::filesystem::file_time_type>(datum / 1000), ec);
+      // !! ifdef c++20
+      //std::error_code ec;
+      //std::filesystem::last_write_time(dir + "/" + chatpartner + "/" + filename, std::chrono::clock_cast<std::filesystem::file_time_type>(datum / 1000), ec);
+    }
+  };
+
+  if (jobs <= 1 || todo.size() <= 1)
+    worker();
+  else
+  {
+    std::vector<std::thread> workers;
+    for (uint w = 0; w < std::min(static_cast<std::size_t>(jobs), todo.size()); ++w)
+      workers.emplace_back(worker);
+    for (auto &w : workers)
+      w.join();
   }
   std::cout << std::endl << "done." << std::endl;
   return true;
@@ -0,0 +1,112 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef EMOJITRIE_H_
+#define EMOJITRIE_H_
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+// prefix tree of the emoji list. Finds the longest emoji at a position
+// in a single walk over the string, instead of comparing every emoji.
+class EmojiTrie
+{
+  struct Node
+  {
+    std::vector<std::pair<unsigned char, unsigned int>> children; // sorted on byte
+    unsigned int length = 0; // non-zero when an emoji ends at this node
+  };
+  std::array<unsigned int, 256> d_root; // first byte -> node (0 = no emoji starts with it)
+  std::vector<Node> d_nodes;
+
+ public:
+  template <std::size_t N>
+  inline explicit EmojiTrie(char const *const (&list)[N]);
+  inline unsigned int match(char const *data, std::size_t size) const;
+};
+
+template <std::size_t N>
+inline EmojiTrie::EmojiTrie(char const *const (&list)[N])
+  :
+  d_root{},
+  d_nodes(1) // node 0 is unused, so it can mean 'none' in d_root
+{
+  for (char const *const emoji : list)
+  {
+    unsigned int length = std::strlen(emoji);
+    if (length == 0) [[unlikely]]
+      continue;
+
+    unsigned char c = static_cast<unsigned char>(emoji[0]);
+    if (d_root[c] == 0)
+    {
+      d_root[c] = d_nodes.size();
+      d_nodes.emplace_back();
+    }
+    unsigned int node = d_root[c];
+
+    for (unsigned int i = 1; i < length; ++i)
+    {
+      c = static_cast<unsigned char>(emoji[i]);
+      auto it = std::lower_bound(d_nodes[node].children.begin(), d_nodes[node].children.end(), c,
+                                 [](std::pair<unsigned char, unsigned int> const &child, unsigned char b) { return child.first < b; });
+      if (it != d_nodes[node].children.end() && it->first == c)
+        node = it->second;
+      else
+      {
+        unsigned int newnode = d_nodes.size();
+        d_nodes[node].children.insert(it, {c, newnode});
+        d_nodes.emplace_back();
+        node = newnode;
+      }
+    }
+    d_nodes[node].length = length;
+  }
+}
+
+// returns the size of the longest emoji at the start of data, or 0 if none
+inline unsigned int EmojiTrie::match(char const *data, std::size_t size) const
+{
+  if (size == 0)
+    return 0;
+
+  unsigned int node = d_root[static_cast<unsigned char>(data[0])];
+  if (node == 0) [[likely]]
+    return 0;
+
+  unsigned int longest = d_nodes[node].length;
+  for (std::size_t i = 1; i < size; ++i)
+  {
+    unsigned char c = static_cast<unsigned char>(data[i]);
+    auto const &children = d_nodes[node].children;
+    auto it = std::lower_bound(children.begin(), children.end(), c,
+                               [](std::pair<unsigned char, unsigned int> const &child, unsigned char b) { return child.first < b; });
+    if (it == children.end() || it->first != c)
+      break;
+    node = it->second;
+    if (d_nodes[node].length)
+      longest = d_nodes[node].length;
+  }
+  return longest;
+}
+
+#endif
@@ -39,21 +39,26 @@ void SignalBackup::exportCsv(std::string const &filename, std::string const &tab
   // output header
   std::ofstream outputfile(filename, std::ios_base::binary);
 
-  SqliteDB::QueryResults results;
-  d_database.exec("SELECT * FROM " + table, &results);
-
-  // output header
-  for (uint i = 0; i < results.columns(); ++i)
-    outputfile << results.header(i) << ((i == results.columns() - 1) ? '\n' : ',');
+  bool headerwritten = false;
+  d_database.execForEach("SELECT * FROM " + table, [&](SqliteDB::QueryResults const &results)
+  {
+    // output header
+    if (!headerwritten)
+    {
+      for (uint i = 0; i < results.columns(); ++i)
+        outputfile << results.header(i) << ((i == results.columns() - 1) ? '\n' : ',');
+      headerwritten = true;
+    }
 
-  // output data
-  for (uint j = 0; j < results.rows(); ++j)
+    // output data
     for (uint i = 0; i < results.columns(); ++i)
     {
-      std::string vas = results.valueAsString(j, i);
+      std::string vas = results.valueAsString(0, i);
       duplicateQuotes(&vas);
       bool escape = (vas.find_first_of(",\"\n") != std::string::npos) || // contains newline, quote or comma
         (!vas.empty() && (std::find_if(vas.begin(), vas.end(), [](char c){ return !std::isspace(c); }) == vas.end())); // is all whitespace (and non empty)
       outputfile << (escape ? "\"" : "") << vas << (escape ? "\"" : "") << ((i == results.columns() - 1) ? '\n' : ',');
     }
+    return true;
+  });
 }
@@ -25,15 +25,18 @@
 
 #include "signalbackup.ih"
 
+#include <atomic>
 #include <cerrno>
+#include <thread>
 
 bool SignalBackup::exportHtml(std::string const &directory, std::vector<long long int> const &limittothreads,
                               std::vector<std::string> const &daterangelist, long long int split,
                               std::string const &selfphone, bool calllog, bool searchpage, bool migrate,
-                              bool overwrite, bool append, bool lighttheme, bool themeswitching) const
+                              bool overwrite, bool append, bool lighttheme, bool themeswitching,
+                              long long int jobs) const
 {
   bool databasemigrated = false;
-  SqliteDB backup_database(":memory:");
+  SqliteDB backup_database(d_databaseondisk ? "" : ":memory:", false /*readonly*/);
 
   // >= 168 will work already? (not sure if 168 and 169 were ever in production, I don't have them at least)
   if (d_databaseversion == 167)
@@ -190,9 +193,13 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
   //   if (skv->key() == "releasechannel.recipient_id")
   //     releasechannel = bepaald::toNumber<int>(skv->value());
 
-  SqliteDB::QueryResults search_idx_results;
+  // the messages for the search page are written in chunks of searchidx_chunksize
+  // to searchidx/messages_N.js, the words in them are collected for the inverted index
+  unsigned int constexpr searchidx_chunksize = 10000;
   std::ofstream searchidx;
-  bool searchidx_write_started = false;
+  std::ofstream searchidx_chunk;
+  unsigned int searchidx_count = 0;
+  std::unordered_map<std::string, std::vector<unsigned int>> searchidx_terms;
   // start search index page
   if (searchpage)
   {
@@ -203,12 +210,28 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
                 << ": Failed to open 'searchidx.js' for writing" << std::endl;
      return false;
     }
-    searchidx << "message_idx = [" << std::endl;
+    if (!bepaald::fileOrDirExists(directory + "/searchidx") && !bepaald::createDir(directory + "/searchidx"))
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+                << ": Failed to create directory `" << directory << "/searchidx'" << std::endl;
+      return false;
+    }
   }
 
-  for (uint t_idx = 0; t_idx < threads.size(); ++t_idx)
+  // these do not change during the export
+  bool mms_has_original_message_id = d_database.tableContainsColumn(d_mms_table, "original_message_id");
+  bool mms_has_revision_number = d_database.tableContainsColumn(d_mms_table, "revision_number");
+  bool mms_has_latest_revision_id = d_database.tableContainsColumn(d_mms_table, "latest_revision_id");
+  bool part_has_caption = d_database.tableContainsColumn("part", "caption");
+
+  // writes the html pages for a single thread. Recipient info missing from the map is added to
+  // *recipientinfo, the thread's entries for the search index (json and plain body) are appended
+  // to *searchidx_entries.
+  // returns false on fatal errors only.
+  auto writethread = [&](long long int t, std::map<long long int, RecipientInfo> *recipientinfo,
+                         std::vector<std::pair<std::string, std::string>> *searchidx_entries) -> bool
   {
-    int t = threads[t_idx];
+    SqliteDB::QueryResults search_idx_results;
 
     // if (t == releasechannel)
     // {
@@ -216,7 +239,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
     //   continue;
     // }
 
-    std::cout << "Dealing with thread " << t << std::endl;
+    std::cout << "Dealing with thread " + bepaald::toString(t) + "\n" << std::flush;
 
     bool is_note_to_self = (t == note_to_self_thread_id);
 
@@ -228,7 +251,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Failed to find recipient_id for thread (" << t << ")... skipping" << std::endl;
-      continue;
+      return true;
     }
     long long int thread_id = recid.getValueAs<long long int>(0, "_id");
 
@@ -245,37 +268,85 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
                     "date_received, " + d_mms_date_sent + ", quote_id, quote_author, quote_body, quote_mentions, " + d_mms_type + ", "
                     "delivery_receipt_count, read_receipt_count, IFNULL(remote_deleted, 0) AS remote_deleted, "
                     "IFNULL(view_once, 0) AS view_once, expires_in, message_ranges, shared_contacts, "
-                    + (d_database.tableContainsColumn(d_mms_table, "original_message_id") ? "original_message_id, " : "") +
-                    + (d_database.tableContainsColumn(d_mms_table, "revision_number") ? "revision_number, " : "") +
+                    + (mms_has_original_message_id ? "original_message_id, " : "") +
+                    + (mms_has_revision_number ? "revision_number, " : "") +
                     "json_extract(link_previews, '$[0].title') AS link_preview_title, "
                     "json_extract(link_previews, '$[0].description') AS link_preview_description "
                     "FROM " + d_mms_table + " "
                     "WHERE thread_id = ?"
                     + datewhereclause +
-                    + (d_database.tableContainsColumn(d_mms_table, "latest_revision_id") ? " AND latest_revision_id IS NULL" : "") +
+                    + (mms_has_latest_revision_id ? " AND latest_revision_id IS NULL" : "") +
                     " ORDER BY date_received ASC", t, &messages);
     if (messages.rows() == 0)
-      continue;
+      return true;
+
+    // get attachments, mentions, reactions and edit revisions for all these messages at once,
+    // per message they are taken from these maps (keyed on message _id)
+    std::string thread_message_ids("SELECT _id FROM " + d_mms_table + " WHERE thread_id = ?" + datewhereclause +
+                                   (mms_has_latest_revision_id ? " AND latest_revision_id IS NULL" : ""));
+
+    SqliteDB::QueryResults results;
+    d_database.exec("SELECT "
+                    "mid, "
+                    "_id, "
+                    "unique_id, "
+                    "ct, "
+                    "file_name, "
+                    "pending_push, " +
+                    (part_has_caption ? "caption, "s : std::string()) +
+                    "sticker_pack_id "
+                    "FROM part WHERE mid IN (" + thread_message_ids + ") AND quote IS 0 ORDER BY _id", t, &results);
+    std::unordered_map<long long int, SqliteDB::QueryResults> thread_attachments(results.groupBy("mid"));
+
+    d_database.exec("SELECT mid,_id,unique_id,ct,file_name,pending_push,sticker_pack_id FROM part WHERE mid IN (" + thread_message_ids + ") AND quote IS 1 ORDER BY _id", t, &results);
+    std::unordered_map<long long int, SqliteDB::QueryResults> thread_quote_attachments(results.groupBy("mid"));
+
+    d_database.exec("SELECT message_id, recipient_id, range_start, range_length FROM mention WHERE message_id IN (" + thread_message_ids + ") ORDER BY rowid", t, &results);
+    std::unordered_map<long long int, SqliteDB::QueryResults> thread_mentions(results.groupBy("message_id"));
+
+    d_database.exec("SELECT message_id, emoji, author_id, DATETIME(ROUND(date_sent / 1000), 'unixepoch', 'localtime') AS 'date_sent', DATETIME(ROUND(date_received / 1000), 'unixepoch', 'localtime') AS 'date_received' "
+                    "FROM reaction WHERE message_id IN (" + thread_message_ids + ") ORDER BY rowid", t, &results);
+    std::unordered_map<long long int, SqliteDB::QueryResults> thread_reactions(results.groupBy("message_id"));
+
+    // revisions are grouped by the id of the original message
+    std::unordered_map<long long int, SqliteDB::QueryResults> thread_revisions;
+    if (mms_has_revision_number)
+    {
+      d_database.exec("SELECT IFNULL(original_message_id, _id) AS revision_group,_id,body,date_received," + d_mms_date_sent + ",revision_number FROM " + d_mms_table +
+                      " WHERE IFNULL(original_message_id, _id) IN (SELECT original_message_id FROM " + d_mms_table + " WHERE thread_id = ? AND original_message_id IS NOT NULL)"
+                      " ORDER BY " + d_mms_date_sent + " ASC", t, &results);
+      thread_revisions = results.groupBy("revision_group");
+    }
+    results.clear();
+
+    // take results for message out of map (each message is only handled once)
+    auto takeresults = [](std::unordered_map<long long int, SqliteDB::QueryResults> *map, long long int id)
+    {
+      SqliteDB::QueryResults r;
+      if (auto it = map->find(id); it != map->end())
+        r = std::move(it->second);
+      return r;
+    };
 
     // get all recipients in thread (group member (past and present), quote/reaction authors, mentions)
     std::set<long long int> all_recipients_ids = getAllThreadRecipients(t);
 
     //try to set any missing info on recipients
-    setRecipientInfo(all_recipients_ids, &recipient_info);
+    setRecipientInfo(all_recipients_ids, recipientinfo);
 
     //for (auto const &ri : recipient_info)
     //  std::cout << ri.first << ": " << ri.second.display_name << std::endl;
 
     // get conversation name, sanitize it and create dir
-    if (recipient_info.find(thread_recipient_id) == recipient_info.end())
+    if (recipientinfo->find(thread_recipient_id) == recipientinfo->end())
     {
       std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                 << ": Failed set recipient info for thread (" << t << ")... skipping" << std::endl;
-      continue;
+      return true;
     }
 
     std::string threaddir = (is_note_to_self ? "Note to self (_id"s + bepaald::toString(thread_id) + ")"
-                             : sanitizeFilename(recipient_info[thread_recipient_id].display_name + " (_id" + bepaald::toString(thread_id) + ")"));
+                             : sanitizeFilename((*recipientinfo)[thread_recipient_id].display_name + " (_id" + bepaald::toString(thread_id) + ")"));
 
     //if (!append)
     //  makeFilenameUnique(directory, &threaddir);
@@ -286,16 +357,12 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                   << ": dir is regular file" << std::endl;
-        if (databasemigrated)
-          SqliteDB::copyDb(backup_database, d_database);
         return false;
       }
       if (!append && !overwrite) // should be impossible at this point....
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
                   << ": Refusing to overwrite existing directory" << std::endl;
-        if (databasemigrated)
-          SqliteDB::copyDb(backup_database, d_database);
         return false;
       }
     }
@@ -314,8 +381,6 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
           std::cout << " Filesize: " << d_fd->total() << std::endl;
         }
       }
-      if (databasemigrated)
-        SqliteDB::copyDb(backup_database, d_database);
       return false;
     }
 
@@ -342,21 +407,19 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
     {
       std::string previous_day_change;
       // create output-file
-      std::string raw_base_filename = (is_note_to_self ? "Note to self" : recipient_info[thread_recipient_id].display_name);
+      std::string raw_base_filename = (is_note_to_self ? "Note to self" : (*recipientinfo)[thread_recipient_id].display_name);
       std::string filename = sanitizeFilename(raw_base_filename + (pagenumber > 0 ? "_" + bepaald::toString(pagenumber) : "") + ".html");
       std::ofstream htmloutput(directory + "/" + threaddir + "/" + filename, std::ios_base::binary);
       if (!htmloutput.is_open())
       {
         std::cout << bepaald::bold_on << "ERROR" << bepaald::bold_off
                   << ": Failed to open '" << directory << "/" << threaddir << "/" << filename << " for writing." << std::endl;
-        if (databasemigrated)
-          SqliteDB::copyDb(backup_database, d_database);
         return false;
       }
 
       // create start of html (css, head, start of body
       HTMLwriteStart(htmloutput, thread_recipient_id, directory, threaddir, isgroup, is_note_to_self,
-                     all_recipients_ids, &recipient_info, &written_avatars, overwrite, append,
+                     all_recipients_ids, recipientinfo, &written_avatars, overwrite, append,
                      lighttheme, themeswitching, searchpage);
       while (messagecount < (max_msg_per_page * (pagenumber + 1)))
       {
@@ -369,7 +432,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
                     << ": Failed to get message recipient id. Skipping." << std::endl;
           continue;
         }
-        long long int original_message_id = (d_database.tableContainsColumn(d_mms_table, "original_message_id") ?
+        long long int original_message_id = (mms_has_original_message_id ?
                                              messages.valueAsInt(messagecount, "original_message_id") :
                                              -1);
         std::string readable_date =
@@ -387,40 +450,25 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
         long long int type = messages.getValueAs<long long int>(messagecount, d_mms_type);
         bool hasquote = !messages.isNull(messagecount, "quote_id") && messages.getValueAs<long long int>(messagecount, "quote_id");
 
-        SqliteDB::QueryResults attachment_results;
-        d_database.exec("SELECT "
-                        "_id, "
-                        "unique_id, "
-                        "ct, "
-                        "file_name, "
-                        "pending_push, " +
-                        (d_database.tableContainsColumn("part", "caption") ? "caption, "s : std::string()) +
-                        "sticker_pack_id "
-                        "FROM part WHERE mid IS ? AND quote IS 0", msg_id, &attachment_results);
+        SqliteDB::QueryResults attachment_results = takeresults(&thread_attachments, msg_id);
         // check attachments for long message body -> replace cropped body & remove from attachment results
         setLongMessageBody(&body, &attachment_results);
 
-        SqliteDB::QueryResults quote_attachment_results;
-        d_database.exec("SELECT _id,unique_id,ct,file_name,pending_push,sticker_pack_id FROM part WHERE mid IS ? AND quote IS 1", msg_id, &quote_attachment_results);
+        SqliteDB::QueryResults quote_attachment_results = takeresults(&thread_quote_attachments, msg_id);
 
-        SqliteDB::QueryResults mention_results;
-        d_database.exec("SELECT recipient_id, range_start, range_length FROM mention WHERE message_id IS ?", msg_id, &mention_results);
+        SqliteDB::QueryResults mention_results = takeresults(&thread_mentions, msg_id);
 
-        SqliteDB::QueryResults reaction_results;
-        d_database.exec("SELECT emoji, author_id, DATETIME(ROUND(date_sent / 1000), 'unixepoch', 'localtime') AS 'date_sent', DATETIME(ROUND(date_received / 1000), 'unixepoch', 'localtime') AS 'date_received'"
-                        "FROM reaction WHERE message_id IS ?", msg_id, &reaction_results);
+        SqliteDB::QueryResults reaction_results = takeresults(&thread_reactions, msg_id);
 
         SqliteDB::QueryResults edit_revisions;
-        if (d_database.tableContainsColumn(d_mms_table, "revision_number"))
-          d_database.exec("SELECT _id,body,date_received," + d_mms_date_sent + ",revision_number FROM " + d_mms_table +
-                          " WHERE _id = ? OR original_message_id = ? ORDER BY " + d_mms_date_sent + " ASC", // skip actual current message
-                          {original_message_id, original_message_id}, &edit_revisions);
+        if (mms_has_revision_number)
+          edit_revisions = takeresults(&thread_revisions, original_message_id);
 
         bool issticker = (attachment_results.rows() == 1 && !attachment_results.isNull(0, "sticker_pack_id"));
 
         IconType icon = IconType::NONE;
         if (Types::isStatusMessage(type))
-          body = decodeStatusMessage(body, messages.getValueAs<long long int>(messagecount, "expires_in"), type, getRecipientInfoFromMap(&recipient_info, msg_recipient_id).display_name, &icon);
+          body = decodeStatusMessage(body, messages.getValueAs<long long int>(messagecount, "expires_in"), type, getRecipientInfoFromMap(recipientinfo, msg_recipient_id).display_name, &icon);
 
         // prep body (scan emoji? -> in <span>) and handle mentions...
         // if (prepbody)
@@ -433,7 +481,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
         if (!messages.isNull(messagecount, "message_ranges"))
           brdata = messages.getValueAs<std::pair<std::shared_ptr<unsigned char []>, size_t>>(messagecount, "message_ranges");
 
-        bool only_emoji = HTMLprepMsgBody(&body, mentions, &recipient_info, incoming, brdata, false /*isquote*/);
+        bool only_emoji = HTMLprepMsgBody(&body, mentions, recipientinfo, incoming, brdata, false /*isquote*/);
 
         bool nobackground = false;
         if ((only_emoji && !hasquote && !attachment_results.rows()) ||  // if no quote etc
@@ -445,7 +493,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
         std::pair<std::shared_ptr<unsigned char []>, size_t> quote_mentions{nullptr, 0};
         if (!messages.isNull(messagecount, "quote_mentions"))
           quote_mentions = messages.getValueAs<std::pair<std::shared_ptr<unsigned char []>, size_t>>(messagecount, "quote_mentions");
-        HTMLprepMsgBody(&quote_body, mentions, &recipient_info, incoming, quote_mentions, true);
+        HTMLprepMsgBody(&quote_body, mentions, recipientinfo, incoming, quote_mentions, true);
 
         // insert date-change message
         if (readable_date_day != previous_day_change)
@@ -513,7 +561,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
 
                                   icon
           });
-        HTMLwriteMessage(htmloutput, msg_info, &recipient_info, searchpage);
+        HTMLwriteMessage(htmloutput, msg_info, recipientinfo, searchpage);
 
         if (searchpage && (!Types::isStatusMessage(msg_info.type) && !msg_info.body.empty()))
         {
@@ -526,6 +574,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
                                "'o', (" + d_mms_table + "." + d_mms_type + " & 0x1F) IN (2,11,21,22,23,24,25,26), "
                                "'d', " + d_mms_table + ".date_received, "
                                "'p', " + "\"" + msg_info.threaddir + "/" + msg_info.filename + "\"" + ") AS line, "
+                               + d_mms_table + ".body AS body, "
                                "part._id AS rowid, "
                                "part.unique_id AS uniqueid "
                                "FROM " + d_mms_table + " "
@@ -543,6 +592,7 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
           std::string line = search_idx_results("line");
           if (line.empty()) [[unlikely]]
             continue;
+          std::string searchbody = search_idx_results("body");
 
           if (search_idx_results.valueAsInt(0, "rowid") != -1 &&
               search_idx_results.valueAsInt(0, "uniqueid") != -1) [[unlikely]]
@@ -553,16 +603,15 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
             std::string longbody = std::string(reinterpret_cast<char *>(a->attachmentData()), a->attachmentSize());
             a->clearData();
 
-            longbody = d_database.getSingleResultAs<std::string>("SELECT json_set(?, '$.b', ?)", {line, longbody}, std::string());
-            if (!longbody.empty()) [[likely]]
-              line = longbody;
+            std::string longline = d_database.getSingleResultAs<std::string>("SELECT json_set(?, '$.b', ?)", {line, longbody}, std::string());
+            if (!longline.empty()) [[likely]]
+            {
+              line = std::move(longline);
+              searchbody = std::move(longbody);
+            }
           }
 
-          if (searchidx_write_started) [[likely]]
-            searchidx << "," << std::endl;
-
-          searchidx << "  " << line;
-          searchidx_write_started = true;
+          searchidx_entries->emplace_back(std::move(line), std::move(searchbody));
         }
 
         if (++messagecount >= messages.rows())
@@ -705,12 +754,123 @@ bool SignalBackup::exportHtml(std::string const &directory, std::vector<long lon
       if (messagecount >= messages.rows())
         break;
     }
+    return true;
+  };
+
+  auto appendsearchidx = [&](std::vector<std::pair<std::string, std::string>> const &entries)
+  {
+    for (auto const &[line, body] : entries)
+    {
+      if (searchidx_count % searchidx_chunksize == 0)
+      {
+        if (searchidx_chunk.is_open())
+        {
+          searchidx_chunk << std::endl << "];" << std::endl;
+          searchidx_chunk.close();
+        }
+        unsigned int chunk = searchidx_count / searchidx_chunksize;
+        searchidx_chunk.open(directory + "/searchidx/messages_" + bepaald::toString(chunk) + ".js", std::ios_base::binary);
+        if (!searchidx_chunk.is_open())
+        {
+          std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+                    << ": Failed to open 'searchidx/messages_" << chunk << ".js' for writing" << std::endl;
+          return false;
+        }
+        searchidx_chunk << "searchidx_messages[" << chunk << "] = [" << std::endl;
+      }
+      else
+        searchidx_chunk << "," << std::endl;
+      searchidx_chunk << "  " << line;
+
+      for (std::string const &term : HTMLsearchTerms(body))
+        searchidx_terms[term].push_back(searchidx_count);
+      ++searchidx_count;
+    }
+    return true;
+  };
+
+  if (jobs > 1 && sqlite3_threadsafe() == 0) [[unlikely]]
+  {
+    std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off
+              << ": SQLite was built without thread safety, ignoring `--jobs'" << std::endl;
+    jobs = 1;
+  }
+
+  if (jobs <= 1 || threads.size() <= 1)
+  {
+    for (uint t_idx = 0; t_idx < threads.size(); ++t_idx)
+    {
+      std::vector<std::pair<std::string, std::string>> searchidx_entries;
+      if (!writethread(threads[t_idx], &recipient_info, &searchidx_entries) ||
+          !appendsearchidx(searchidx_entries))
+      {
+        if (databasemigrated)
+          SqliteDB::copyDb(backup_database, d_database);
+        return false;
+      }
+    }
+  }
+  else
+  {
+    // The threads are divided over the workers. They all share the (serialized) database
+    // connection, but get their own copy of the recipient info, which is filled for all
+    // threads beforehand so workers rarely need to add to it. The shared avatars are loaded
+    // up front as well, so no two workers try to do that at once.
+    std::set<long long int> all_recipients_ids;
+    for (long long int t : threads)
+      all_recipients_ids.merge(getAllThreadRecipients(t));
+    setRecipientInfo(all_recipients_ids, &recipient_info);
+    for (auto const &a : d_avatars)
+      a.second->attachmentData();
+
+    uint nworkers = std::min(static_cast<uint>(jobs), static_cast<uint>(threads.size()));
+    std::vector<std::map<long long int, RecipientInfo>> worker_recipient_info(nworkers, recipient_info);
+    std::vector<std::vector<std::pair<std::string, std::string>>> searchidx_entries(threads.size());
+    std::atomic<uint> next_t_idx(0);
+    std::atomic<bool> failed(false);
+
+    std::vector<std::thread> workers;
+    for (uint w = 0; w < nworkers; ++w)
+      workers.emplace_back([&, w]()
+      {
+        uint t_idx;
+        while (!failed && (t_idx = next_t_idx++) < threads.size())
+          if (!writethread(threads[t_idx], &worker_recipient_info[w], &searchidx_entries[t_idx]))
+            failed = true;
+      });
+    for (auto &w : workers)
+      w.join();
+
+    for (uint t_idx = 0; !failed && t_idx < searchidx_entries.size(); ++t_idx)
+      if (!appendsearchidx(searchidx_entries[t_idx]))
+        failed = true;
+
+    if (failed)
+    {
+      if (databasemigrated)
+        SqliteDB::copyDb(backup_database, d_database);
+      return false;
+    }
+
+    for (auto &wri : worker_recipient_info)
+      recipient_info.merge(wri);
   }
 
   if (searchpage)
   {
-    if (searchidx_write_started) [[likely]]
-      searchidx << std::endl << "];" << std::endl;
+    if (searchidx_chunk.is_open()) [[likely]]
+    {
+      searchidx_chunk << std::endl << "];" << std::endl;
+      searchidx_chunk.close();
+    }
+    searchidx << "searchidx_count = " << searchidx_count << ";" << std::endl;
+    searchidx << "searchidx_chunksize = " << searchidx_chunksize << ";" << std::endl;
+    if (!HTMLwriteSearchIndexTerms(directory, searchidx_terms, searchidx))
+    {
+      if (databasemigrated)
+        SqliteDB::copyDb(backup_database, d_database);
+      return false;
+    }
 
     // write recipient info:
     //std::map<long long int, RecipientInfo> recipient_info;
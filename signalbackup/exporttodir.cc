@@ -69,9 +69,13 @@ bool SignalBackup::exportBackupToDir(std::string const &directory, bool overwrit
         std::cout << "Failed to open file for writing: " << directory << attachment_basefilename << ".bin" << std::endl;
         return false;
       }
-      else
+      else if (keepattachmentdatainmemory)
+      {
         if (!attachmentstream.write(reinterpret_cast<char *>(a->attachmentData()), a->attachmentSize()))
           return false;
+      }
+      else if (!a->writeAttachmentData(attachmentstream)) // don't load all of it
+        return false;
 
       if (!keepattachmentdatainmemory)
       {
@@ -19,6 +19,9 @@
 
 #include "signalbackup.ih"
 
+#include <numeric>
+#include <limits>
+
 bool SignalBackup::exportBackupToFile(std::string const &filename, std::string const &passphrase, bool overwrite, bool keepattachmentdatainmemory)
 {
   std::cout << std::endl << "Exporting backup to '" << filename << "'" << std::endl;
@@ -83,7 +86,18 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
   d_database.exec(q, &results);
   std::vector<std::string> tables;
 
-  for (uint i = 0; i < results.rows(); ++i)
+  // objects that were read from a backup file are written in their original order (indexes
+  // and triggers were created after loading the data), anything created later goes after those
+  std::vector<uint> schemaorder(results.rows());
+  std::iota(schemaorder.begin(), schemaorder.end(), 0);
+  auto schemaposition = [&](uint i)
+  {
+    auto it = results.isNull(i, 0) ? d_schemaorder.end() : d_schemaorder.find(results.getValueAs<std::string>(i, 0));
+    return it == d_schemaorder.end() ? std::numeric_limits<uint64_t>::max() : it->second;
+  };
+  std::stable_sort(schemaorder.begin(), schemaorder.end(), [&](uint a, uint b) { return schemaposition(a) < schemaposition(b); });
+
+  for (uint i : schemaorder)
   {
     if (!results.isNull(i, 0))
     {
@@ -146,17 +160,19 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
         STRING_STARTS_WITH(table, "sqlite_"))
       continue;
 
-    d_database.exec("SELECT * FROM " + table, &results);
+    long long int rowcount = d_database.getSingleResultAs<long long int>("SELECT COUNT(*) FROM " + table, 0);
 
     if (!d_showprogress)
       std::cout << "  Dealing with table '" << table << "'... " << std::flush;
 
-    for (uint i = 0; i < results.rows(); ++i)
+    // rows are handed over one at a time, the table is not copied into memory
+    long long int i = 0;
+    if (!d_database.execForEach("SELECT * FROM " + table, [&](SqliteDB::QueryResults const &r)
     {
       if (d_showprogress)
-        std::cout << "\33[2K\r  Dealing with table '" << table << "'... " << i + 1 << "/" << results.rows() << " entries..." << std::flush;
+        std::cout << "\33[2K\r  Dealing with table '" << table << "'... " << i + 1 << "/" << rowcount << " entries..." << std::flush;
 
-      SqlStatementFrame newframe = buildSqlStatementFrame(table, results.row(i));
+      SqlStatementFrame newframe = buildSqlStatementFrame(table, r.row(0));
 
       //std::cout << "Writing SqlStatementFrame..." << std::endl;
       if (!writeEncryptedFrame(outputfile, &newframe))
@@ -165,18 +181,18 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
       if (table == "part") // find corresponding attachment
       {
         uint64_t rowid = 0, uniqueid = 0;
-        for (uint j = 0; j < results.columns(); ++j)
+        for (uint j = 0; j < r.columns(); ++j)
         {
-          if (results.header(j) == "_id" && results.valueHasType<long long int>(i, j))
+          if (r.header(j) == "_id" && r.valueHasType<long long int>(0, j))
           {
-            rowid = results.getValueAs<long long int>(i, j);
+            rowid = r.getValueAs<long long int>(0, j);
             if (rowid && uniqueid)
               break;
           }
-          else if (results.header(j) == "unique_id" && results.valueHasType<long long int>(i, j))
+          else if (r.header(j) == "unique_id" && r.valueHasType<long long int>(0, j))
           {
            //std::cout << "UNIQUEID: " << std::any_cast<long long int>(results[i][j].second) << std::endl;
-            uniqueid = results.getValueAs<long long int>(i, j);
+            uniqueid = r.getValueAs<long long int>(0, j);
             if (rowid && uniqueid)
               break;
           }
@@ -199,17 +215,17 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
           {
             std::cout << "Warning: attachment data not found (rowid: " << rowid << ", uniqueid: " << uniqueid << ")" << std::endl;
             if (d_showprogress)
-              std::cout << "\33[2K\r  Dealing with table '" << table << "'... " << i + 1 << "/" << results.rows() << " entries..." << std::flush;
+              std::cout << "\33[2K\r  Dealing with table '" << table << "'... " << i + 1 << "/" << rowcount << " entries..." << std::flush;
           }
         }
       }
       else if (table == "sticker") // find corresponding sticker
       {
         uint64_t rowid = 0;
-        for (uint j = 0; j < results.columns(); ++j)
-          if (results.header(j) == "_id" && results.valueHasType<long long int>(i, j))
+        for (uint j = 0; j < r.columns(); ++j)
+          if (r.header(j) == "_id" && r.valueHasType<long long int>(0, j))
           {
-            rowid = results.getValueAs<long long int>(i, j);
+            rowid = r.getValueAs<long long int>(0, j);
             break;
           }
         auto sticker = d_stickers.find(rowid);
@@ -224,11 +240,15 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
         {
           std::cout << "Warning: sticker data not found (rowid: " << rowid << ")" << std::endl;
           if (d_showprogress)
-            std::cout << "\33[2K\r  Dealing with table '" << table << "'... " << i + 1 << "/" << results.rows() << " entries..." << std::flush;
+            std::cout << "\33[2K\r  Dealing with table '" << table << "'... " << i + 1 << "/" << rowcount << " entries..." << std::flush;
         }
       }
-    }
-    if (results.rows())
+      ++i;
+      return true;
+    }))
+      return false;
+
+    if (rowcount)
         std::cout << "done" << std::endl;
     else
       std::cout << "  Dealing with table '" << table << "'... 0/0 entries..." << std::endl;
@@ -272,8 +292,18 @@ bool SignalBackup::exportBackupToFile(std::string const &filename, std::string c
   if (!writeEncryptedFrame(outputfile, d_endframe.get()))
     return false;
 
-  outputfile.flush();
+  // a skipped (corrupted) attachment may have been written past the end of what follows it
+  uint64_t filesize = outputfile.tellp();
+  outputfile.close();
+  std::error_code ec;
+  if (std::filesystem::file_size(filename, ec) > filesize && !ec)
+    std::filesystem::resize_file(filename, filesize, ec);
+  if (outputfile.fail() || ec)
+  {
+    std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Failed to finish writing output file" << std::endl;
+    return false;
+  }
 
-  std::cout << "Done! Wrote " << outputfile.tellp() << " bytes." << std::endl;
+  std::cout << "Done! Wrote " << filesize << " bytes." << std::endl;
   return true;
 }
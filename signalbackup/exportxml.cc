@@ -659,50 +659,51 @@ bool SignalBackup::exportXml(std::string const &filename, bool overwrite, std::s
                        Types::BASE_PENDING_SECURE_SMS_FALLBACK, Types::BASE_PENDING_INSECURE_SMS_FALLBACK,  Types::BASE_DRAFT_TYPE}, &sms_results);
   }
 
-  SqliteDB::QueryResults mms_results;
+  // the mms results are not collected, but streamed (see below)
+  std::string mms_query;
+  std::vector<std::any> mms_params{Types::GROUP_UPDATE_BIT, Types::BASE_INBOX_TYPE, Types::BASE_OUTBOX_TYPE, Types::BASE_SENDING_TYPE, Types::BASE_SENT_TYPE, Types::BASE_SENT_FAILED_TYPE,
+                                   Types::BASE_PENDING_SECURE_SMS_FALLBACK, Types::BASE_PENDING_INSECURE_SMS_FALLBACK,  Types::BASE_DRAFT_TYPE};
   if (includemms)
   {
     // at dbv 109 many columns were removed from the mms table.
     if (d_databaseversion >= 109)
-      d_database.exec("SELECT _id,thread_id,date_received," + d_mms_date_sent + "," + d_mms_recipient_id + (d_database.tableContainsColumn(d_mms_table, "to_recipient_id") ? ",to_recipient_id" : "") +
-                      "," + d_mms_type + ","
-                      "(" + d_mms_type + " & " + bepaald::toString(Types::BASE_TYPE_MASK) + ") AS base_type,body,expires_in,read,ct_l,m_type,m_size,exp,tr_id,st FROM " + d_mms_table +
-                      " WHERE "
-                      + d_mms_recipient_id + " IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND " +
-                      (d_database.tableContainsColumn(d_mms_table, "to_recipient_id") ? "to_recipient_id IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND " : "") +
-                      "(" + d_mms_type + " & ?) == 0 AND "
-                      "(base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ?)",
-                      {Types::GROUP_UPDATE_BIT, Types::BASE_INBOX_TYPE, Types::BASE_OUTBOX_TYPE, Types::BASE_SENDING_TYPE, Types::BASE_SENT_TYPE, Types::BASE_SENT_FAILED_TYPE,
-                       Types::BASE_PENDING_SECURE_SMS_FALLBACK, Types::BASE_PENDING_INSECURE_SMS_FALLBACK,  Types::BASE_DRAFT_TYPE}, &mms_results);
+      mms_query = "SELECT _id,thread_id,date_received," + d_mms_date_sent + "," + d_mms_recipient_id + (d_database.tableContainsColumn(d_mms_table, "to_recipient_id") ? ",to_recipient_id" : "") +
+                  "," + d_mms_type + ","
+                  "(" + d_mms_type + " & " + bepaald::toString(Types::BASE_TYPE_MASK) + ") AS base_type,body,expires_in,read,ct_l,m_type,m_size,exp,tr_id,st FROM " + d_mms_table +
+                  " WHERE "
+                  + d_mms_recipient_id + " IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND " +
+                  (d_database.tableContainsColumn(d_mms_table, "to_recipient_id") ? "to_recipient_id IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND " : "") +
+                  "(" + d_mms_type + " & ?) == 0 AND "
+                  "(base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ?)";
     else
-      d_database.exec("SELECT _id,thread_id,date_received," + d_mms_date_sent + "," + d_mms_recipient_id + "," + d_mms_type + ","
-                      "(" + d_mms_type + " & " + bepaald::toString(Types::BASE_TYPE_MASK) + ") AS base_type,body,expires_in,read,m_id,sub,ct_t,ct_l,m_type,m_size,rr,read_status,"
-                      "m_cls,sub_cs,ct_cls,v,pri,retr_st,retr_txt,retr_txt_cs,d_tm,d_rpt,exp,resp_txt,tr_id,st,resp_st,rpt_a FROM " + d_mms_table + " WHERE "
-                      + d_mms_recipient_id + " IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND "
-                      "(" + d_mms_type + " & ?) == 0 AND "
-                      "(base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ?)",
-                      {Types::GROUP_UPDATE_BIT, Types::BASE_INBOX_TYPE, Types::BASE_OUTBOX_TYPE, Types::BASE_SENDING_TYPE, Types::BASE_SENT_TYPE, Types::BASE_SENT_FAILED_TYPE,
-                       Types::BASE_PENDING_SECURE_SMS_FALLBACK, Types::BASE_PENDING_INSECURE_SMS_FALLBACK,  Types::BASE_DRAFT_TYPE}, &mms_results);
+      mms_query = "SELECT _id,thread_id,date_received," + d_mms_date_sent + "," + d_mms_recipient_id + "," + d_mms_type + ","
+                  "(" + d_mms_type + " & " + bepaald::toString(Types::BASE_TYPE_MASK) + ") AS base_type,body,expires_in,read,m_id,sub,ct_t,ct_l,m_type,m_size,rr,read_status,"
+                  "m_cls,sub_cs,ct_cls,v,pri,retr_st,retr_txt,retr_txt_cs,d_tm,d_rpt,exp,resp_txt,tr_id,st,resp_st,rpt_a FROM " + d_mms_table + " WHERE "
+                  + d_mms_recipient_id + " IN (SELECT _id FROM recipient WHERE " + d_recipient_e164 + " IS NOT NULL OR group_id IS NOT NULL) AND "
+                  "(" + d_mms_type + " & ?) == 0 AND "
+                  "(base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ? OR base_type == ?)";
   }
 
+  long long int mms_count = includemms ? d_database.getSingleResultAs<long long int>("SELECT COUNT(*) FROM (" + mms_query + ")", mms_params, 0) : 0;
+
   std::string date;
-  outputfile << "<smses count=\"" << bepaald::toString(sms_results.rows() + mms_results.rows())
+  outputfile << "<smses count=\"" << bepaald::toString(sms_results.rows() + mms_count)
              << "\" backup_date=\"" << date << "\" type=\"full\">" << std::endl;
   uint sms_row = 0;
-  uint mms_row = 0;
-  while (sms_row < sms_results.rows() ||
-         mms_row < mms_results.rows())
-  {
-    if (mms_row >= mms_results.rows() ||
-        (sms_row < sms_results.rows() &&
-         (sms_results.getValueAs<long long int>(sms_row, d_sms_date_received) <
-          mms_results.getValueAs<long long int>(mms_row, "date_received"))))
-      handleSms(sms_results, outputfile, self, sms_row++);
-    else if (mms_row < mms_results.rows())
-      handleMms(mms_results, outputfile, self, mms_row++, keepattachmentdatainmemory);
-
-    //std::cout << "Handled row! Indices now: " << sms_row << "/" << sms_results.rows() << " " << mms_row << "/" << mms_results.rows() << std::endl;
-  }
+  // mms rows are handled one by one, straight from the database. Any sms rows
+  // that go before the current mms are written first.
+  if (includemms)
+    d_database.execForEach(mms_query, mms_params, [&](SqliteDB::QueryResults const &mms_results)
+    {
+      while (sms_row < sms_results.rows() &&
+             (sms_results.getValueAs<long long int>(sms_row, d_sms_date_received) <
+              mms_results.getValueAs<long long int>(0, "date_received")))
+        handleSms(sms_results, outputfile, self, sms_row++);
+      handleMms(mms_results, outputfile, self, 0, keepattachmentdatainmemory);
+      return true;
+    });
+  while (sms_row < sms_results.rows())
+    handleSms(sms_results, outputfile, self, sms_row++);
 
   outputfile << "</smses>" << std::endl;
 
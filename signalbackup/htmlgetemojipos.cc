@@ -32,36 +32,15 @@ std::vector<std::pair<unsigned int, unsigned int>> SignalBackup::HTMLgetEmojiPos
 
   std::vector<std::pair<unsigned int, unsigned int>> results;
 
-  for (uint i = 0; i < std::max(static_cast<unsigned int>(str.size()), s_emoji_min_size) - s_emoji_min_size; ++i)
+  // note: the smallest emoji is s_emoji_min_size + 1 bytes
+  for (uint i = 0; i + s_emoji_min_size < str.size(); ++i)
   {
     //std::cout << "Checking byte " << std::dec << i << ": " << std::hex << static_cast<int>(str[i] & 0xff) << std::endl;
-    if (bepaald::contains(s_emoji_first_bytes, str[i]))
+    if (unsigned int emoji_size = s_emoji_trie.match(str.data() + i, str.size() - i); emoji_size > 0)
     {
-      for (char const *const emoji_string : s_emoji_unicode_list)
-      {
-        int emoji_size = std::strlen(emoji_string);
-        if (i <= (str.size() - emoji_size) &&
-            std::strncmp(str.data() + i, emoji_string, emoji_size) == 0)
-        {
-
-          // std::cout << "matched emoji: ";
-          // for (uint c = 0; c < emoji_size; ++c)
-          //   std::cout << std::hex << static_cast<int>(emoji_string[c] & 0xff);
-          // std::cout << "" << std::endl;
-
-          results.emplace_back(std::make_pair(i, emoji_size));
-          i += emoji_size - 1; // minus one because ++i in for loop
-
-          //str->insert(i, "<*>");
-          //str->insert(i + 3 + emoji_size, "<*>");
-          //i += 3 + emoji_size + 3;
-
-          //std::cout << *str << std::endl;
-        }
-      }
+      results.emplace_back(std::make_pair(i, emoji_size));
+      i += emoji_size - 1; // minus one because ++i in for loop
     }
-    //else if (str->at(i) != ' ') // spaces don't count
-    //  all_emoji = false;
   }
   return results;
 }
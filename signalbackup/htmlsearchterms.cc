@@ -0,0 +1,158 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+// Splits a message body into the terms used for the inverted index on the
+// search page. The body is case folded (see statics_casefold.cc) and split into
+// words, every position in a word then gives a term of (at most)
+// s_searchidx_ngram_size code points. Indexing n-grams instead of whole words
+// lets the page find any substring, also in scripts that do not separate their
+// words with spaces. NOTE the searchTerms() and searchIndex() functions in the
+// javascript of HTMLwriteSearchpage() must split the same way.
+std::set<std::string> SignalBackup::HTMLsearchTerms(std::string const &body) const
+{
+  auto isseparator = [](uint32_t cp)
+  {
+    return (cp < 0x80 && !((cp >= '0' && cp <= '9') || (cp >= 'A' && cp <= 'Z') || (cp >= 'a' && cp <= 'z'))) ||
+      (cp >= 0x80 && cp <= 0xbf) ||    // latin-1 controls, spaces and punctuation
+      cp == 0xd7 || cp == 0xf7 ||      // multiplication and division signs
+      (cp >= 0x2000 && cp <= 0x206f) || // general punctuation
+      (cp >= 0x3000 && cp <= 0x303f);   // cjk punctuation
+  };
+
+  // appends the case folded code point to word
+  auto fold = [](uint32_t cp, std::vector<uint32_t> *word)
+  {
+    auto range = std::upper_bound(std::begin(s_casefold_ranges), std::end(s_casefold_ranges), cp,
+                                  [](uint32_t c, CaseFoldRange const &r) { return c < r.first; });
+    if (range != std::begin(s_casefold_ranges) &&
+        cp <= std::prev(range)->last && (cp - std::prev(range)->first) % std::prev(range)->stride == 0)
+    {
+      word->push_back(cp + std::prev(range)->delta);
+      return;
+    }
+    auto expansion = std::lower_bound(std::begin(s_casefold_expansions), std::end(s_casefold_expansions), cp,
+                                      [](CaseFoldExpansion const &e, uint32_t c) { return e.codepoint < c; });
+    if (expansion != std::end(s_casefold_expansions) && expansion->codepoint == cp)
+    {
+      for (uint32_t c : expansion->folded)
+        if (c)
+          word->push_back(c);
+      return;
+    }
+    word->push_back(cp);
+  };
+
+  auto appendutf8 = [](uint32_t cp, std::string *str)
+  {
+    if (cp < 0x80)
+      *str += static_cast<char>(cp);
+    else if (cp < 0x800)
+    {
+      *str += static_cast<char>(0xc0 | (cp >> 6));
+      *str += static_cast<char>(0x80 | (cp & 0x3f));
+    }
+    else if (cp < 0x10000)
+    {
+      *str += static_cast<char>(0xe0 | (cp >> 12));
+      *str += static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+      *str += static_cast<char>(0x80 | (cp & 0x3f));
+    }
+    else
+    {
+      *str += static_cast<char>(0xf0 | (cp >> 18));
+      *str += static_cast<char>(0x80 | ((cp >> 12) & 0x3f));
+      *str += static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+      *str += static_cast<char>(0x80 | (cp & 0x3f));
+    }
+  };
+
+  std::set<std::string> terms;
+  auto addngrams = [&](std::vector<uint32_t> const &word)
+  {
+    for (uint i = 0; i < word.size(); ++i)
+    {
+      std::string term;
+      for (uint j = i; j < word.size() && j < i + s_searchidx_ngram_size; ++j)
+        appendutf8(word[j], &term);
+      terms.insert(std::move(term));
+    }
+  };
+
+  std::vector<uint32_t> folded;
+  std::vector<uint32_t> word;
+  for (uint i = 0; i < body.size();)
+  {
+    // decode next code point, invalid utf-8 is treated as a separator
+    unsigned char c = static_cast<unsigned char>(body[i]);
+    uint32_t cp = 0x80;
+    unsigned int size = 1;
+    if (c < 0x80)
+      cp = c;
+    else if ((c & 0xe0) == 0xc0)
+    {
+      cp = c & 0x1f;
+      size = 2;
+    }
+    else if ((c & 0xf0) == 0xe0)
+    {
+      cp = c & 0x0f;
+      size = 3;
+    }
+    else if ((c & 0xf8) == 0xf0)
+    {
+      cp = c & 0x07;
+      size = 4;
+    }
+    if (size > 1)
+    {
+      if (i + size > body.size())
+        size = 1;
+      for (uint j = 1; j < size; ++j)
+      {
+        if ((static_cast<unsigned char>(body[i + j]) & 0xc0) != 0x80)
+        {
+          size = 1;
+          break;
+        }
+        cp = (cp << 6) | (static_cast<unsigned char>(body[i + j]) & 0x3f);
+      }
+      if (size == 1)
+        cp = 0x80;
+    }
+    i += size;
+
+    // words are split after folding, the page folds its query before splitting as well
+    folded.clear();
+    fold(cp, &folded);
+    for (uint32_t f : folded)
+    {
+      if (isseparator(f))
+      {
+        addngrams(word);
+        word.clear();
+      }
+      else
+        word.push_back(f);
+    }
+  }
+  addngrams(word);
+  return terms;
+}
@@ -74,7 +74,7 @@ bool SignalBackup::HTMLwriteStart(std::ofstream &file, long long int thread_reci
 
   std::time_t now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
   //file << "<!-- Generated on " << std::put_time(std::localtime(&now), "%F %T") // %F and %T do not work on minGW
-  file << "<!-- Generated on " << std::put_time(std::localtime(&now), "%Y-%m-%d %H:%M:%S")
+  file << "<!-- Generated on " << bepaald::toDateString(now, "%Y-%m-%d %H:%M:%S")
        << " by signalbackup-tools (" << VERSIONDATE << "). "
        << "Input database version: " << d_databaseversion << ". -->" << std::endl;
 
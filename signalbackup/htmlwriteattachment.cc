@@ -83,7 +83,7 @@ bool SignalBackup::HTMLwriteAttachment(std::string const &directory, std::string
   }
   else
   {
-    if (!attachmentstream.write(reinterpret_cast<char *>(a->attachmentData()), a->attachmentSize()))
+    if (!a->writeAttachmentData(attachmentstream))
       return false;
     // write was succesfull. drop attachment data
     a->clearData();
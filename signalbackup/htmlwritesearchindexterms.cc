@@ -0,0 +1,89 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+// Writes the inverted index for the search page: the terms are split over
+// shard files by their first two characters, so the page only needs to load
+// the shards for the words it is searching for. The list of shards, and the
+// case folding tables the page needs to fold its query the same way
+// HTMLsearchTerms() did, are written to the (already opened) searchidx.js.
+bool SignalBackup::HTMLwriteSearchIndexTerms(std::string const &directory,
+                                             std::unordered_map<std::string, std::vector<unsigned int>> const &terms,
+                                             std::ofstream &searchidx) const
+{
+  auto utf8size = [](unsigned char c)
+  {
+    return (c & 0xf8) == 0xf0 ? 4 : ((c & 0xf0) == 0xe0 ? 3 : ((c & 0xe0) == 0xc0 ? 2 : 1));
+  };
+
+  // group (sorted) terms by shard
+  std::map<std::string, std::map<std::string_view, std::vector<unsigned int> const *>> shards;
+  for (auto const &[term, ids] : terms)
+  {
+    unsigned int keysize = utf8size(term[0]);
+    if (keysize < term.size())
+      keysize += utf8size(term[keysize]);
+    shards[term.substr(0, keysize)].emplace(term, &ids);
+  }
+
+  searchidx << "searchidx_shards = {";
+  for (auto s = shards.begin(); s != shards.end(); ++s)
+  {
+    std::string filename = "terms_" + bepaald::bytesToHexString(reinterpret_cast<unsigned char const *>(s->first.data()), s->first.size(), true);
+    std::ofstream shard(directory + "/searchidx/" + filename + ".js", std::ios_base::binary);
+    if (!shard.is_open())
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+                << ": Failed to open 'searchidx/" << filename << ".js' for writing" << std::endl;
+      return false;
+    }
+
+    // the terms contain no quotes, backslashes or control characters, they need no escaping
+    shard << "searchidx_terms[\"" << s->first << "\"] = {" << std::endl;
+    for (auto t = s->second.begin(); t != s->second.end(); ++t)
+    {
+      shard << "  \"" << t->first << "\":[";
+      for (uint i = 0; i < t->second->size(); ++i)
+        shard << (i ? "," : "") << (*t->second)[i];
+      shard << "]" << (std::next(t) != s->second.end() ? "," : "") << std::endl;
+    }
+    shard << "};" << std::endl;
+
+    searchidx << (s != shards.begin() ? "," : "") << std::endl << "  \"" << s->first << "\":\"" << filename << "\"";
+  }
+  searchidx << std::endl << "};" << std::endl;
+
+  searchidx << "searchidx_ngramsize = " << s_searchidx_ngram_size << ";" << std::endl;
+  searchidx << "searchidx_casefold_ranges = [";
+  for (uint i = 0; i < std::size(s_casefold_ranges); ++i)
+    searchidx << (i ? "," : "") << "[" << s_casefold_ranges[i].first << "," << s_casefold_ranges[i].last << ","
+              << s_casefold_ranges[i].delta << "," << s_casefold_ranges[i].stride << "]";
+  searchidx << "];" << std::endl;
+  searchidx << "searchidx_casefold_expansions = {";
+  for (uint i = 0; i < std::size(s_casefold_expansions); ++i)
+  {
+    searchidx << (i ? "," : "") << s_casefold_expansions[i].codepoint << ":[";
+    for (uint j = 0; j < std::size(s_casefold_expansions[i].folded) && s_casefold_expansions[i].folded[j]; ++j)
+      searchidx << (j ? "," : "") << s_casefold_expansions[i].folded[j];
+    searchidx << "]";
+  }
+  searchidx << "};" << std::endl;
+  return true;
+}
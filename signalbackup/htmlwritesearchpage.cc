@@ -640,13 +640,151 @@ body {
     var firstbutton = document.getElementById("searchfirst");
     var lastbutton = document.getElementById("searchlast");
 
-    function getSearchFieldAndSearch()
+    /* the search index is loaded on demand: searchidx/terms_*.js map words to message numbers,
+       searchidx/messages_*.js hold the messages themselves */
+    var searchidx_terms = {};
+    var searchidx_messages = [];
+    var searchidx_loading = {};
+
+    function loadScript(src)
+    {
+      if (!(src in searchidx_loading))
+        searchidx_loading[src] = new Promise((resolve) => {
+          var script = document.createElement('script');
+          script.src = src;
+          script.onload = resolve;
+          script.onerror = resolve;
+          document.head.append(script);
+        });
+      return searchidx_loading[src];
+    }
+
+    async function loadMessages(chunks)
+    {
+      await Promise.all(Array.from(chunks, c => loadScript('searchidx/messages_' + c + '.js')));
+    }
+
+    /* must match HTMLsearchTerms() in signalbackup-tools: returns the case folded words
+       of str, as arrays of code points */
+    function searchTerms(str)
+    {
+      function isSeparator(cp)
+      {
+        return (cp < 0x80 && !((cp >= 0x30 && cp <= 0x39) || (cp >= 0x41 && cp <= 0x5a) || (cp >= 0x61 && cp <= 0x7a))) ||
+          (cp >= 0x80 && cp <= 0xbf) || cp == 0xd7 || cp == 0xf7 ||
+          (cp >= 0x2000 && cp <= 0x206f) || (cp >= 0x3000 && cp <= 0x303f);
+      }
+      function fold(cp)
+      {
+        var lo = 0;
+        var hi = searchidx_casefold_ranges.length;
+        while (lo < hi)
+        {
+          var mid = (lo + hi) >> 1;
+          if (searchidx_casefold_ranges[mid][0] <= cp)
+            lo = mid + 1;
+          else
+            hi = mid;
+        }
+        if (lo > 0)
+        {
+          const [first, last, delta, stride] = searchidx_casefold_ranges[lo - 1];
+          if (cp <= last && (cp - first) % stride == 0)
+            return [cp + delta];
+        }
+        return searchidx_casefold_expansions[cp] || [cp];
+      }
+
+      var terms = [];
+      var term = [];
+      for (const c of str)
+        for (const cp of fold(c.codePointAt(0)))
+        {
+          if (isSeparator(cp))
+          {
+            if (term.length > 0)
+              terms.push(term);
+            term = [];
+          }
+          else
+            term.push(cp);
+        }
+      if (term.length > 0)
+        terms.push(term);
+      return terms;
+    }
+
+    /* returns the numbers of all messages that may contain every term, or null if the
+       index can not be used for this search. The index holds every n-gram (of
+       searchidx_ngramsize code points, shorter at the end of a word) of the words in a
+       message. A long term needs its n-grams (enough of them to cover it) to be in the
+       message, a short one needs an n-gram starting with it. */
+    async function searchIndex(term, regex)
+    {
+      var terms = regex ? [] : searchTerms(term);
+      if (terms.length == 0)
+        return null;
+
+      var candidates = null;
+      for (const t of terms)
+      {
+        var grams = [];
+        if (t.length <= searchidx_ngramsize)
+          grams.push(t);
+        else
+        {
+          for (var i = 0; i + searchidx_ngramsize < t.length; i += searchidx_ngramsize)
+            grams.push(t.slice(i, i + searchidx_ngramsize));
+          grams.push(t.slice(t.length - searchidx_ngramsize));
+        }
+
+        for (const g of grams)
+        {
+          var gram = String.fromCodePoint(...g);
+          var key = String.fromCodePoint(...g.slice(0, 2));
+          var keys = Object.keys(searchidx_shards).filter(k => k.startsWith(key)); // a one-character term needs all its shards
+          await Promise.all(keys.map(k => loadScript('searchidx/' + searchidx_shards[k] + '.js')));
+
+          var found = new Set();
+          for (const k of keys)
+          {
+            if (g.length == searchidx_ngramsize)
+              (searchidx_terms[k]?.[gram] || []).forEach(id => found.add(id));
+            else
+              for (const [ngram, ids] of Object.entries(searchidx_terms[k] || {}))
+                if (ngram.startsWith(gram))
+                  ids.forEach(id => found.add(id));
+          }
+
+          candidates = (candidates === null) ? found : new Set(Array.from(candidates).filter(id => found.has(id)));
+          if (candidates.size == 0)
+            return [];
+        }
+      }
+      return Array.from(candidates).sort((a, b) => a - b);
+    }
+
+    async function getSearchFieldAndSearch()
     {
       searchstr = document.getElementById('search_field').value;
       if (!searchstr || searchstr.length === 0)
         return;
+      document.getElementById("summary").innerHTML = "(searching...)";
       //start = performance.now();
-      global_results = search(message_idx, searchstr, document.getElementById('enable_regex').checked);
+      var regex = document.getElementById('enable_regex').checked;
+      var messages = [];
+      var ids = await searchIndex(searchstr, regex);
+      if (ids === null) // no usable terms, or regex: check all messages
+      {
+        await loadMessages(Array.from({length: Math.ceil(searchidx_count / searchidx_chunksize)}, (_, i) => i));
+        messages = searchidx_messages.flat();
+      }
+      else
+      {
+        await loadMessages(new Set(ids.map(id => Math.floor(id / searchidx_chunksize))));
+        messages = ids.map(id => searchidx_messages[Math.floor(id / searchidx_chunksize)][id % searchidx_chunksize]);
+      }
+      global_results = search(messages, searchstr, regex);
       //end = performance.now();
       //console.log(`Execution time: ${end - start} ms`);
       global_searchstring = searchstr;
@@ -333,6 +333,11 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
   // this map will map desktop-recipient-uuid's to android recipient._id's
   std::map<std::string, long long int> recipientmap;
 
+  // all messages are imported in one transaction, which is released whenever the loop below is left
+  d_database.exec("SAVEPOINT importfromdesktop");
+  auto releasesavepoint = [](SqliteDB const *db) { db->exec("RELEASE importfromdesktop"); };
+  std::unique_ptr<SqliteDB const, decltype(releasesavepoint)> savepoint(&d_database, releasesavepoint);
+
   // for each conversation
   for (uint i = 0; i < results_all_conversations.rows(); ++i)
   {
@@ -548,6 +553,23 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
     }
     //results_all_messages_from_conversation.printLineMode();
 
+    // get the bodyRanges (styles and mentions) of all messages in this conversation at once,
+    // the row numbers in the results are grouped by message
+    SqliteDB::QueryResults results_all_bodyranges_from_conversation;
+    std::map<long long int, std::vector<uint>> bodyranges_by_message;
+    if (!ddb.exec("SELECT "
+                  "messages.rowid AS message_rowid,"
+                  "json_extract(json_each.value, '$.start') AS range_start,"
+                  "json_extract(json_each.value, '$.length') AS range_length,"
+                  "json_extract(json_each.value, '$.style') AS range_style,"
+                  "LOWER(COALESCE(json_extract(json_each.value, '$.mentionAci'), json_extract(json_each.value, '$.mentionUuid'))) AS mention_uuid"
+                  " FROM messages, json_each(messages.json, '$.bodyRanges')"
+                  " WHERE conversationId = ?" + datewhereclause + " ORDER BY messages.rowid, json_each.key",
+                  results_all_conversations.value(i, "id"), &results_all_bodyranges_from_conversation))
+      std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " Failed to retrieve body ranges and mentions for this conversation." << std::endl;
+    for (uint r = 0; r < results_all_bodyranges_from_conversation.rows(); ++r)
+      bodyranges_by_message[results_all_bodyranges_from_conversation.getValueAs<long long int>(r, "message_rowid")].push_back(r);
+
     std::cout << " - Importing " << results_all_messages_from_conversation.rows() << " messages into thread._id " << ttid << std::endl;
     for (uint j = 0; j < results_all_messages_from_conversation.rows(); ++j)
     {
@@ -1427,27 +1449,17 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
         {
           //ddb.prettyPrint("SELECT json_extract(json, '$.bodyRanges') FROM messages WHERE rowid IS ?", rowid);
           BodyRanges bodyrangelist;
-          SqliteDB::QueryResults ranges_results;
-          for (uint r = 0; r < hasranges; ++r)
+          for (uint r : bodyranges_by_message[rowid])
           {
-            if (ddb.exec("SELECT "
-                         "json_extract(json, '$.bodyRanges[" + bepaald::toString(r) + "].start') AS range_start,"
-                         "json_extract(json, '$.bodyRanges[" + bepaald::toString(r) + "].length') AS range_length,"
-                         "json_extract(json, '$.bodyRanges[" + bepaald::toString(r) + "].style') AS range_style"
-                         " FROM messages WHERE rowid IS ?", rowid, &ranges_results))
-            {
-              if (ranges_results.isNull(0, "range_style"))
-                continue;
-
-              //ranges_results.prettyPrint();
+            if (results_all_bodyranges_from_conversation.isNull(r, "range_style"))
+              continue;
 
-              BodyRange bodyrange;
-              if (ranges_results.getValueAs<long long int>(0, "range_start") != 0)
-                bodyrange.addField<1>(ranges_results.getValueAs<long long int>(0, "range_start"));
-              bodyrange.addField<2>(ranges_results.getValueAs<long long int>(0, "range_length"));
-              bodyrange.addField<4>(ranges_results.getValueAs<long long int>(0, "range_style") - 1); // NOTE desktop style enum starts at 1 (android 0)
-              bodyrangelist.addField<1>(bodyrange);
-            }
+            BodyRange bodyrange;
+            if (results_all_bodyranges_from_conversation.getValueAs<long long int>(r, "range_start") != 0)
+              bodyrange.addField<1>(results_all_bodyranges_from_conversation.getValueAs<long long int>(r, "range_start"));
+            bodyrange.addField<2>(results_all_bodyranges_from_conversation.getValueAs<long long int>(r, "range_length"));
+            bodyrange.addField<4>(results_all_bodyranges_from_conversation.getValueAs<long long int>(r, "range_style") - 1); // NOTE desktop style enum starts at 1 (android 0)
+            bodyrangelist.addField<1>(bodyrange);
           }
           if (bodyrangelist.size())
           {
@@ -1480,31 +1492,19 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
 
         // insert into mentions
         if (d_verbose) [[unlikely]] std::cout << "Inserting mentions..." << std::flush;
-        for (uint k = 0; k < nummentions; ++k)
+        for (uint k : bodyranges_by_message[rowid])
         {
-          SqliteDB::QueryResults results_mentions;
-          if (!ddb.exec("SELECT "
-                        "json_extract(json, '$.bodyRanges[" + bepaald::toString(k) + "].start') AS start,"
-                        "json_extract(json, '$.bodyRanges[" + bepaald::toString(k) + "].length') AS length,"
-                        "LOWER(COALESCE(json_extract(json, '$.bodyRanges[" + bepaald::toString(k) + "].mentionAci'), json_extract(json, '$.bodyRanges[" + bepaald::toString(k) + "].mentionUuid'))) AS mention_uuid"
-                        " FROM messages WHERE rowid = ?", rowid, &results_mentions))
-          {
-            std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " Failed to retrieve mentions. Skipping." << std::endl;
-            continue;
-          }
-          //std::cout << "  Mention " << k + 1 << "/" << nummentions << std::endl;
-
           // NOTE Desktop uses the same bodyRanges field for styling {start,length,style} and mentions {start,length,mentionUuid}.
           // if this is a style, mentionUuid will not exist, and we should skip it.
-          if (results_mentions.isNull(0, "mention_uuid"))
+          if (results_all_bodyranges_from_conversation.isNull(k, "mention_uuid"))
             continue;
 
-          long long int rec_id = getRecipientIdFromUuid(results_mentions.valueAsString(0, "mention_uuid"), &recipientmap, createmissingcontacts);
+          long long int rec_id = getRecipientIdFromUuid(results_all_bodyranges_from_conversation.valueAsString(k, "mention_uuid"), &recipientmap, createmissingcontacts);
           if (rec_id == -1)
           {
             if (createmissingcontacts)
             {
-              if ((rec_id = dtCreateRecipient(ddb, results_mentions("mention_uuid"), std::string(), std::string(), databasedir, &recipientmap, &warned_createcontacts)) == -1)
+              if ((rec_id = dtCreateRecipient(ddb, results_all_bodyranges_from_conversation.valueAsString(k, "mention_uuid"), std::string(), std::string(), databasedir, &recipientmap, &warned_createcontacts)) == -1)
               {
                 std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " Failed to create recipient for mention. Skipping." << std::endl;
                 continue;
@@ -1521,8 +1521,8 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
                          {{"thread_id", ttid},
                           {"message_id", new_mms_id},
                           {"recipient_id", rec_id},
-                          {"range_start", results_mentions.getValueAs<long long int>(0, "start")},
-                          {"range_length", results_mentions.getValueAs<long long int>(0, "length")}}))
+                          {"range_start", results_all_bodyranges_from_conversation.getValueAs<long long int>(k, "range_start")},
+                          {"range_length", results_all_bodyranges_from_conversation.getValueAs<long long int>(k, "range_length")}}))
           {
             std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << ": Inserting into mention" << std::endl;
           }
@@ -1570,6 +1570,8 @@ bool SignalBackup::importFromDesktop(std::string configdir, std::string database
     //updateThreadsEntries(ttid);
   }
 
+  savepoint.reset();
+
   for (auto const &r : recipientmap)
   {
     //std::cout << "Recpients in map: " << r.first << " : " << r.second << std::endl;
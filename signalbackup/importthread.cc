@@ -786,8 +786,68 @@ table|sender_keys|sender_keys|71|CREATE TABLE sender_keys (_id INTEGER PRIMARY K
   // update thread snippet and date and count
   updateThreadsEntries();
 
+  if (d_verbose) [[unlikely]]
+    std::cout << "Prepared statement cache: " << d_database.statementCacheHits() << " hits, "
+              << d_database.statementCacheMisses() << " misses" << std::endl;
+
   d_database.exec("VACUUM");
   d_database.freeMemory();
 
   return checkDbIntegrity();
 }
+
+/*
+  Imports several threads from the same source. importThread() changes the source (it is
+  cropped to the thread, its ids are made unique and its attachments and avatars are moved
+  into this backup), so the source database is kept in a snapshot and restored before every
+  next thread. The attachment- and avatar frames are restored from copies, which only refer
+  to the data in the source file, so nothing needs to be read from the file again.
+*/
+bool SignalBackup::importThread(SignalBackup *source, std::vector<long long int> const &threads)
+{
+  SqliteDB snapshot(source->d_databaseondisk ? "" : ":memory:", false /*readonly*/);
+  std::map<std::pair<uint64_t, uint64_t>, std::unique_ptr<AttachmentFrame>> attachments;
+  std::vector<std::pair<std::string, std::unique_ptr<AvatarFrame>>> avatars;
+  if (threads.size() > 1)
+  {
+    if (!SqliteDB::copyDb(source->d_database, snapshot))
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+                << ": Failed to create snapshot of source database" << std::endl;
+      return false;
+    }
+    for (auto const &att : source->d_attachments)
+      attachments.emplace(att.first, new AttachmentFrame(*att.second));
+    for (auto const &av : source->d_avatars)
+      avatars.emplace_back(av.first, new AvatarFrame(*av.second));
+  }
+
+  for (uint i = 0; i < threads.size(); ++i)
+  {
+    if (i > 0) // restore source
+    {
+      if (!SqliteDB::copyDb(snapshot, source->d_database))
+      {
+        std::cout << bepaald::bold_on << "Error" << bepaald::bold_off
+                  << ": Failed to restore source database from snapshot" << std::endl;
+        return false;
+      }
+      source->d_attachments.clear();
+      for (auto const &att : attachments)
+        source->d_attachments.emplace(att.first, new AttachmentFrame(*att.second));
+      source->d_avatars.clear();
+      for (auto const &av : avatars)
+        source->d_avatars.emplace_back(av.first, new AvatarFrame(*av.second));
+    }
+
+    MEMINFO("Before import: ", i + 1, "/", threads.size());
+    std::cout << std::endl << "Importing thread " << threads[i] << " (" << i + 1 << "/" << threads.size() << ")" << std::endl;
+    if (!importThread(source, threads[i]))
+    {
+      std::cout << "A fatal error occurred while trying to import thread " << threads[i] << ". Aborting" << std::endl;
+      return false;
+    }
+    MEMINFO("After import");
+  }
+  return true;
+}
@@ -238,6 +238,17 @@ void SignalBackup::initFromDir(std::string const &inputdir, bool replaceattachme
 #endif
 
 
+  // the iv and salt from the header, and the database's size and modification time identify it in
+  // the cache of integrity checks (reading, let alone hashing, the whole database could cost more
+  // than the check it saves)
+  ec.clear();
+  uintmax_t databasesize = std::filesystem::file_size(inputdir + "/database.sqlite", ec);
+  auto mtime = ec ? std::filesystem::file_time_type() : std::filesystem::last_write_time(inputdir + "/database.sqlite", ec);
+  if (d_headerframe && !ec)
+    d_integritycachekey = "dir:" + bepaald::bytesToHexString(d_headerframe->iv(), d_headerframe->iv_length(), true) +
+      bepaald::bytesToHexString(d_headerframe->salt(), d_headerframe->salt_length(), true) + ":" + bepaald::toString(databasesize) +
+      ":" + bepaald::toString(mtime.time_since_epoch().count());
+
   std::cout << "Done!" << std::endl;
   d_ok = true;
 }
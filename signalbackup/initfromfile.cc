@@ -19,7 +19,7 @@
 
 #include "signalbackup.ih"
 
-void SignalBackup::initFromFile()
+void SignalBackup::initFromFile(std::string const &filename)
 {
   if (!d_fd->ok())
   {
@@ -34,10 +34,21 @@ void SignalBackup::initFromFile()
 
   d_database.exec("BEGIN TRANSACTION");
 
+  // indexes and triggers are created after all data is loaded, so they are
+  // built once instead of being updated (or fired) for every inserted row
+  std::vector<std::string> deferredstatements;
+
+  // reused for every statement, the parameters refer to the data in the frame itself
+  std::string query;
+  std::vector<SqliteDB::ParameterView> parameters;
+
+  bool badmac = false;
+
   while ((frame = d_fd->getFrame())) // deal with bad mac??
   {
     if (d_fd->badMac()) [[unlikely]]
     {
+      badmac = true;
       dumpInfoOnBadFrame(&frame);
       if (d_stoponerror)
         return;
@@ -80,17 +91,32 @@ void SignalBackup::initFromFile()
 
       //std::cout << s->statement() << std::endl;
 
-      if (s->statement().find("CREATE TABLE sqlite_") == std::string::npos) [[likely]] // skip creation of sqlite_ internal db's
+      // the statement with placeholders, statement() would also fill in the parameters. CREATE
+      // statements do not have any, so for those the two are the same.
+      std::string_view statement(s->statementView());
+
+      // remember the original order of the schema, so it can be written back the same way
+      if (STRING_STARTS_WITH(statement, "CREATE ")) [[unlikely]]
+        d_schemaorder.emplace(statement, d_schemaorder.size());
+
+      // indexes and triggers are created after the data is loaded. Except UNIQUE indexes: those
+      // must reject duplicate rows (in damaged backups) while loading, as they did originally
+      if (STRING_STARTS_WITH(statement, "CREATE INDEX ") ||
+          STRING_STARTS_WITH(statement, "CREATE TRIGGER ")) [[unlikely]]
+        deferredstatements.emplace_back(statement);
+      else if (statement.find("CREATE TABLE sqlite_") == std::string_view::npos) [[likely]] // skip creation of sqlite_ internal db's
       {
         // NOTE: in the official import, there are other tables that are skipped (virtual tables for search data)
         // we lazily do not check for them here, since we are dealing with official exported files which do not contain
         // these tables as they are excluded on the export-side as well. Additionally, the official import should be able
         // to properly deal with them anyway (that is: ignore them)
-        if (!d_database.exec(s->bindStatement(), s->parameters()))
+        query.assign(statement);
+        s->parameterViews(&parameters);
+        if (!d_database.exec(query, parameters))
           std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Failed to execute statement: " << s->statement() << std::endl;
       }
       #ifdef BUILT_FOR_TESTING
-      else if (s->statement().find("CREATE TABLE sqlite_sequence") != std::string::npos)
+      else if (statement.find("CREATE TABLE sqlite_sequence") != std::string_view::npos)
       {
         // force early creation of sqlite_sequence table, this is completely unnecessary and only used
         // to get byte-identical backups during testing
@@ -137,8 +163,37 @@ void SignalBackup::initFromFile()
     }
   }
 
+  if (!deferredstatements.empty())
+  {
+    if (d_showprogress) [[likely]]
+      std::cout << (d_verbose ? "" : "\33[2K\r") << "Creating indexes and triggers... " << std::flush;
+
+    bool createdtriggers = false;
+    for (auto const &statement : deferredstatements)
+    {
+      if (!d_database.exec(statement))
+        std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Failed to execute statement: " << statement << std::endl;
+      else if (STRING_STARTS_WITH(statement, "CREATE TRIGGER "))
+        createdtriggers = true;
+    }
+
+    // the triggers on the message tables fill the full-text search tables, which
+    // did not happen for the rows inserted above. Those tables index external content,
+    // and can simply be rebuilt from it.
+    SqliteDB::QueryResults fts_tables;
+    if (createdtriggers &&
+        d_database.exec("SELECT name FROM sqlite_master WHERE type = 'table' AND sql LIKE 'CREATE VIRTUAL TABLE % USING fts5(%content=%'", &fts_tables))
+      for (uint i = 0; i < fts_tables.rows(); ++i)
+        if (!d_database.exec("INSERT INTO " + fts_tables(i, "name") + "(" + fts_tables(i, "name") + ") VALUES('rebuild')"))
+          std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Failed to rebuild full-text search table '" << fts_tables(i, "name") << "'" << std::endl;
+  }
+
   d_database.exec("COMMIT");
 
+  if (d_verbose) [[unlikely]]
+    std::cout << std::endl << "Prepared statement cache: " << d_database.statementCacheHits() << " hits, "
+              << d_database.statementCacheMisses() << " misses" << std::endl;
+
   if (!d_badattachments.empty())
   {
     std::cout << "Attachment data with BAD MAC was encountered:" << std::endl;
@@ -161,5 +216,15 @@ void SignalBackup::initFromFile()
     addEndFrame();
   }
 
+  // all frames are authenticated, so the iv and salt from the header identify the contents of this
+  // file. Files written by this program may keep the iv and salt of their input, so size and
+  // modification time are added to tell those apart.
+  std::error_code ec;
+  auto mtime = std::filesystem::last_write_time(filename, ec);
+  if (!badmac && d_headerframe && !ec)
+    d_integritycachekey = "file:" + bepaald::bytesToHexString(d_headerframe->iv(), d_headerframe->iv_length(), true) +
+      bepaald::bytesToHexString(d_headerframe->salt(), d_headerframe->salt_length(), true) + ":" + bepaald::toString(totalsize) +
+      ":" + bepaald::toString(mtime.time_since_epoch().count());
+
   d_ok = true;
 }
@@ -0,0 +1,47 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+std::string SignalBackup::integrityCacheFile()
+{
+#if defined(_WIN32) || defined(__MINGW64__)
+  char const *cachedir_cs = getenv("LOCALAPPDATA");
+  if (cachedir_cs == nullptr)
+    return std::string();
+  std::string cachedir(cachedir_cs);
+#else
+  std::string cachedir;
+  char const *xdgcache_cs = getenv("XDG_CACHE_HOME");
+  if (xdgcache_cs != nullptr)
+    cachedir = xdgcache_cs;
+  else
+  {
+    char const *homedir_cs = getenv("HOME");
+    if (homedir_cs == nullptr)
+      return std::string();
+    std::string homedir(homedir_cs);
+    if (!homedir.empty())
+      cachedir = homedir + "/.cache";
+  }
+#endif
+  if (cachedir.empty())
+    return std::string();
+  return cachedir + "/signalbackup-tools/integritycheck.cache";
+}
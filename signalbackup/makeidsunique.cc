@@ -328,6 +328,13 @@ void SignalBackup::makeIdsUnique(SignalBackup *source)
 
   std::cout << "  Adjusting indexes in tables..." << std::endl;
 
+  // For every table, shifting the ids by the offset and then compacting them is combined into one
+  // old->new mapping, which is applied to the table and all its linked columns in one go. Ids that
+  // are not in the mapping (or are not compacted) are only shifted.
+  source->d_database.exec("DROP TABLE IF EXISTS temp.makeidsunique_map");
+  source->d_database.exec("CREATE TEMP TABLE makeidsunique_map(old INTEGER PRIMARY KEY, new INTEGER NOT NULL)");
+  source->d_database.exec("SAVEPOINT makeidsunique");
+
   for (auto const &dbl : d_databaselinks)
   {
     // skip if table/column does not exist, or if skip is set
@@ -346,8 +353,46 @@ void SignalBackup::makeIdsUnique(SignalBackup *source)
     }
 
     long long int offsetvalue = getMaxUsedId(dbl.table, dbl.column) + 1 - source->getMinUsedId(dbl.table, dbl.column);
-    source->setMinimumId(dbl.table, offsetvalue, dbl.column);
 
+    // the positive (shifted) ids are compacted, starting at the lowest one (see compactIds())
+    source->d_database.exec("DELETE FROM temp.makeidsunique_map");
+    if (!(dbl.flags & NO_COMPACT))
+    {
+      std::cout << "  Compacting table: " << dbl.table << " (" << dbl.column << ")" << std::endl;
+      source->d_database.exec("INSERT INTO temp.makeidsunique_map SELECT old, new FROM "
+                              "(SELECT old, MIN(old) OVER () + ? + ROW_NUMBER() OVER (ORDER BY old) - 1 AS new "
+                              "FROM (SELECT DISTINCT " + dbl.column + " AS old FROM " + dbl.table + " WHERE " + dbl.column + " + ? > 0)) "
+                              "WHERE new != old + ?", {offsetvalue, offsetvalue, offsetvalue});
+    }
+    bool usemap = source->d_database.getSingleResultAs<long long int>("SELECT COUNT(*) FROM temp.makeidsunique_map", 0) > 0;
+    if (offsetvalue == 0 && !usemap) // no changes needed
+      continue;
+
+    // returns the new value for 'current', binds 'offsetvalue' once
+    auto newvalue = [](std::string const &current, bool mapped)
+    {
+      return mapped ? "IFNULL((SELECT new FROM temp.makeidsunique_map WHERE old = " + current + "), " + current + " + ?)" : current + " + ?";
+    };
+
+    // columns with UNIQUE constraints are first moved out of the way of all old and new values, so
+    // no duplicates are created halfway through the update
+    auto remapunique = [&](std::string const &table, std::string const &column, std::string const &whereclause, bool mapped)
+    {
+      long long int tmpoffset = 2 * source->d_database.getSingleResultAs<long long int>("SELECT CAST(IFNULL(MAX(ABS(" + column + ")), 0) AS INTEGER) FROM " + table, 0) +
+        std::abs(offsetvalue) + 1;
+      std::string where(" WHERE " + column + " IS NOT NULL" + (whereclause.empty() ? "" : " AND " + whereclause));
+      source->d_database.exec("UPDATE " + table + " SET " + column + " = " + column + " + ?" + where, tmpoffset);
+      if (mapped)
+        source->d_database.exec("UPDATE " + table + " SET " + column + " = " + newvalue("(" + column + " - ?)", true) + where, {tmpoffset, tmpoffset, offsetvalue});
+      else
+        source->d_database.exec("UPDATE " + table + " SET " + column + " = " + newvalue("(" + column + " - ?)", false) + where, {tmpoffset, offsetvalue});
+    };
+
+    std::cout << "  Adjusting '" << dbl.table << "." << dbl.column << "'" << std::endl;
+    remapunique(dbl.table, dbl.column, std::string(), usemap);
+
+    // compactIds only updates linked columns of the _id column
+    bool maplinks = usemap && dbl.column == "_id";
     for (auto const &c : dbl.connections)
     {
       if (source->d_databaseversion >= c.mindbvversion && source->d_databaseversion <= c.maxdbvversion)
@@ -359,57 +404,44 @@ void SignalBackup::makeIdsUnique(SignalBackup *source)
 
         if (!c.json_path.empty())
         {
+          std::string current("json_extract(" + c.column + ", " + c.json_path + ")");
           source->d_database.exec("UPDATE " + c.table + " SET " + c.column +
-                                  " = json_replace(" + c.column + ", " + c.json_path + ", json_extract(" + c.column + ", " + c.json_path + ") + ?) "
-                                  "WHERE json_extract(" + c.column + ", " + c.json_path + ") IS NOT NULL", offsetvalue);
+                                  " = json_replace(" + c.column + ", " + c.json_path + ", " + newvalue(current, maplinks) + ") "
+                                  "WHERE " + current + " IS NOT NULL", offsetvalue);
         }
         else if ((c.flags & SET_UNIQUELY))
-        {
-          // set all values negative
-          source->d_database.exec("UPDATE " + c.table + " SET " + c.column + " = " + c.column + " * -1" +
-                                  (c.whereclause.empty() ? "" : " WHERE " + c.whereclause));
-          // set to wanted value
-          source->d_database.exec("UPDATE " + c.table + " SET " + c.column + " = " + c.column + " * -1 + ?"
-                                  + (c.whereclause.empty() ? "" : " WHERE " + c.whereclause), offsetvalue);
-        }
+          remapunique(c.table, c.column, c.whereclause, maplinks);
         else
-          source->d_database.exec("UPDATE " + c.table + " SET " + c.column + " = " + c.column + " + ? "
+          source->d_database.exec("UPDATE " + c.table + " SET " + c.column + " = " + newvalue(c.column, maplinks)
                                   + (c.whereclause.empty() ? "" : " WHERE " + c.whereclause), offsetvalue);
       }
     }
 
     if (dbl.table == "part")
     {
-      // update rowid's in attachments
-      std::map<std::pair<uint64_t, uint64_t>, std::unique_ptr<AttachmentFrame>> newattdb;
-      for (auto &att : source->d_attachments)
+      std::map<uint64_t, uint64_t> newrowids;
+      if (usemap)
       {
-        AttachmentFrame *a = reinterpret_cast<AttachmentFrame *>(att.second.release());
-        a->setRowId(a->rowId() + offsetvalue);
-        newattdb.emplace(std::make_pair(a->rowId(), a->attachmentId()), a);
+        SqliteDB::QueryResults results;
+        source->d_database.exec("SELECT old, new FROM temp.makeidsunique_map", &results);
+        for (uint i = 0; i < results.rows(); ++i)
+          newrowids.emplace(results.getValueAs<long long int>(i, "old"), results.getValueAs<long long int>(i, "new"));
       }
-      source->d_attachments.clear();
-      source->d_attachments = std::move(newattdb);
 
-      /*
-        REPLACED WITH JSON OPTION IN DatabaseConnections
-
-        // update rowid in previews (mms.previews contains a json string referencing the 'rowId' == part._id)
-      SqliteDB::QueryResults results;
-      source->d_database.exec("SELECT _id,previews FROM mms WHERE previews IS NOT NULL", &results);
-      std::regex rowid_in_json(".*\"rowId\":([0-9]*)[,}].*");
-      std::smatch sm;
-      for (uint i = 0; i < results.rows(); ++i)
+      // update rowid's in attachments. The nodes are taken out and reinserted with their new key, since
+      // the new keys may still be in use by other attachments while rekeying.
+      std::vector<decltype(source->d_attachments)::node_type> attachments;
+      attachments.reserve(source->d_attachments.size());
+      while (!source->d_attachments.empty())
+        attachments.emplace_back(source->d_attachments.extract(source->d_attachments.begin()));
+      for (auto &att : attachments)
       {
-        std::string line = results.valueAsString(i, "previews");
-        if (std::regex_match(line, sm, rowid_in_json))
-          if (sm.size() == 2) // 0 is full match, 1 is first submatch (which is what we want)
-          {
-            line.replace(sm.position(1), sm.length(1), bepaald::toString(bepaald::toNumber<unsigned long>(sm[1]) + offsetvalue));
-            source->d_database.exec("UPDATE mms SET previews = ? WHERE _id = ?", {line, results.getValueAs<long long int>(i, "_id")});
-          }
+        AttachmentFrame *a = att.mapped().get();
+        auto newrowid = newrowids.find(a->rowId());
+        a->setRowId(newrowid != newrowids.end() ? newrowid->second : a->rowId() + offsetvalue);
+        att.key().first = a->rowId();
+        source->d_attachments.insert(std::move(att));
       }
-      */
     }
 
     if (dbl.table == "recipient")
@@ -424,12 +456,11 @@ void SignalBackup::makeIdsUnique(SignalBackup *source)
       //update (old-style)reaction authors
       source->updateReactionAuthors(offsetvalue);
     }
-
-    // compact table if requested
-    if (!(dbl.flags & NO_COMPACT))
-      source->compactIds(dbl.table, dbl.column);
   }
 
+  source->d_database.exec("RELEASE makeidsunique");
+  source->d_database.exec("DROP TABLE temp.makeidsunique_map");
+
   /*
 
     CHECK!
@@ -23,100 +23,63 @@ bool SignalBackup::reorderMmsSmsIds() const
 {
   std::cout << __FUNCTION__ << std::endl;
 
-  // get all mms in the correct order
-  SqliteDB::QueryResults res;
-  if (!d_database.exec("SELECT _id FROM " + d_mms_table + " ORDER BY date_received ASC", &res)) // for sms table, use 'date'
-    return false;
-
-  // set all id's 'negatively ascending' (negative because of UNIQUE constraint)
-  long long int negative_id_tmp = 0;
-  for (uint i = 0; i < res.rows(); ++i)
+  // The new _id of every message is its position when ordered by date_received. This mapping is
+  // calculated in one go, and applied to the table and every column referencing it with a single
+  // UPDATE each. The new id's are first set negative (because of UNIQUE constraints on _id), and
+  // made positive again at the end.
+  auto reorder = [this](std::string const &table, std::string const &datecolumn,
+                        std::vector<std::pair<std::string, std::string>> const &links) // {table.column, whereclause}
   {
-    long long int oldid = res.getValueAs<long long int>(i, 0);
-    ++negative_id_tmp;
-    if (!d_database.exec("UPDATE " + d_mms_table + " SET _id = ? WHERE _id = ?", {-1 * negative_id_tmp, oldid}) ||
-        !d_database.exec("UPDATE part SET mid = ? WHERE mid = ?", {-1 * negative_id_tmp, oldid}) ||
-        !d_database.exec("UPDATE group_receipts SET mms_id = ? WHERE mms_id = ?", {-1 * negative_id_tmp, oldid}))
+    d_database.exec("DROP TABLE IF EXISTS temp.reorder_map");
+    if (!d_database.exec("CREATE TEMP TABLE reorder_map(old INTEGER PRIMARY KEY, new INTEGER NOT NULL)") ||
+        !d_database.exec("INSERT INTO temp.reorder_map SELECT _id, ROW_NUMBER() OVER (ORDER BY " + datecolumn + " ASC, _id ASC) FROM " + table))
       return false;
-    if (d_database.containsTable("mention"))
-      if (!d_database.exec("UPDATE mention SET message_id = ? WHERE message_id = ?", {-1 * negative_id_tmp, oldid}))
-        return false;
-    if (d_database.containsTable("msl_message"))
-      if (!d_database.exec("UPDATE msl_message SET message_id = ? WHERE message_id = ?"s + (d_database.tableContainsColumn("msl_message", "is_mms") ? " AND is_mms IS 1" : ""), {-1 * negative_id_tmp, oldid}))
-        return false;
-    if (d_database.containsTable("reaction")) // dbv >= 121
-      if (!d_database.exec("UPDATE reaction SET message_id = ? WHERE message_id = ?"s + (d_database.tableContainsColumn("reaction", "is_mms") ? " AND is_mms IS 1" : ""), {-1 * negative_id_tmp, oldid}))
-        return false;
-    if (d_database.containsTable("story_sends"))
-      if (!d_database.exec("UPDATE story_sends SET message_id = ? WHERE message_id = ?", {-1 * negative_id_tmp, oldid}))
-        return false;
-    if (d_database.containsTable("call")) // dbv >= ~168?
-      if (!d_database.exec("UPDATE call SET message_id = ? WHERE message_id = ?", {-1 * negative_id_tmp, oldid}))
-        return false;
-    if (d_database.tableContainsColumn(d_mms_table, "original_message_id")) // dbv >= ~197
-      if (!d_database.exec("UPDATE " + d_mms_table + " SET original_message_id = ? WHERE original_message_id = ?", {-1 * negative_id_tmp, oldid}))
-        return false;
-    if (d_database.tableContainsColumn(d_mms_table, "latest_revision_id")) // dbv >= ~197
-      if (!d_database.exec("UPDATE " + d_mms_table + " SET latest_revision_id = ? WHERE latest_revision_id = ?", {-1 * negative_id_tmp, oldid}))
-        return false;
-  }
 
-  // now make all id's positive again
-  if (!d_database.exec("UPDATE " + d_mms_table + " SET _id = _id * -1 WHERE _id < 0") ||
-      !d_database.exec("UPDATE part SET mid = mid * -1 WHERE mid < 0") ||
-      !d_database.exec("UPDATE group_receipts SET mms_id = mms_id * -1 WHERE mms_id < 0"))
+    // only the linked columns present in this database
+    std::vector<std::tuple<std::string, std::string, std::string>> columns; // table, column, whereclause
+    for (auto const &[tablecolumn, whereclause] : links)
+    {
+      std::string::size_type dot = tablecolumn.find('.');
+      std::string t = tablecolumn.substr(0, dot);
+      std::string c = tablecolumn.substr(dot + 1);
+      if (d_database.containsTable(t) && d_database.tableContainsColumn(t, c))
+        columns.emplace_back(t, c, whereclause);
+    }
+
+    bool ok = d_database.exec("UPDATE " + table + " SET _id = -temp.reorder_map.new FROM temp.reorder_map WHERE " + table + "._id = temp.reorder_map.old");
+    for (auto const &[t, c, whereclause] : columns)
+      ok = ok && d_database.exec("UPDATE " + t + " SET " + c + " = -temp.reorder_map.new FROM temp.reorder_map WHERE " + t + "." + c + " = temp.reorder_map.old" + whereclause);
+
+    // now make all id's positive again
+    ok = ok && d_database.exec("UPDATE " + table + " SET _id = _id * -1 WHERE _id < 0");
+    for (auto const &[t, c, whereclause] : columns)
+      ok = ok && d_database.exec("UPDATE " + t + " SET " + c + " = " + c + " * -1 WHERE " + c + " < 0" + whereclause);
+
+    d_database.exec("DROP TABLE temp.reorder_map");
+    return ok;
+  };
+
+  std::string msl_is_mms(d_database.tableContainsColumn("msl_message", "is_mms") ? " AND is_mms IS 1" : "");
+  std::string reaction_is_mms(d_database.tableContainsColumn("reaction", "is_mms") ? " AND is_mms IS 1" : "");
+  if (!reorder(d_mms_table, "date_received", {{"part.mid", ""},
+                                              {"group_receipts.mms_id", ""},
+                                              {"mention.message_id", ""},
+                                              {"msl_message.message_id", msl_is_mms},
+                                              {"reaction.message_id", reaction_is_mms},
+                                              {"story_sends.message_id", ""},
+                                              {"call.message_id", ""}, // dbv >= ~168?
+                                              {d_mms_table + ".original_message_id", ""},   // dbv >= ~197
+                                              {d_mms_table + ".latest_revision_id", ""}}))  // dbv >= ~197
     return false;
-  if (d_database.containsTable("mention"))
-    if (!d_database.exec("UPDATE mention SET message_id = message_id * -1 WHERE message_id < 0"))
-      return false;
-  if (d_database.containsTable("msl_message"))
-    if (!d_database.exec("UPDATE msl_message SET message_id = message_id * -1 WHERE message_id < 0"s + (d_database.tableContainsColumn("msl_message", "is_mms") ? " AND is_mms IS 1" : "")))
-      return false;
-  if (d_database.containsTable("reaction")) // dbv >= 121
-    if (!d_database.exec("UPDATE reaction SET message_id = message_id * -1 WHERE message_id < 0"s + (d_database.tableContainsColumn("reaction", "is_mms") ? " AND is_mms IS 1" : "")))
-      return false;
-  if (d_database.containsTable("story_sends"))
-    if (!d_database.exec("UPDATE story_sends SET message_id = message_id * -1 WHERE message_id < 0"))
-      return false;
-  if (d_database.containsTable("call")) // dbv >= ~168?
-    if (!d_database.exec("UPDATE call SET message_id = message_id * -1 WHERE message_id < 0"))
-      return false;
-  if (d_database.tableContainsColumn(d_mms_table, "original_message_id")) // dbv >= ~197
-    if (!d_database.exec("UPDATE " + d_mms_table + " SET original_message_id = original_message_id * -1 WHERE original_message_id < 0"))
-      return false;
-  if (d_database.tableContainsColumn(d_mms_table, "latest_revision_id")) // dbv >= ~197
-    if (!d_database.exec("UPDATE " + d_mms_table + " SET latest_revision_id = latest_revision_id * -1 WHERE latest_revision_id < 0"))
-      return false;
 
   // SAME FOR SMS
   if (d_database.containsTable("sms")) // removed in 168
   {
-    if (!d_database.exec("SELECT _id FROM sms ORDER BY " + d_sms_date_received + " ASC", &res))
-      return false;
-
-    negative_id_tmp = 0;
-    for (uint i = 0; i < res.rows(); ++i)
-    {
-      long long int oldid = res.getValueAs<long long int>(i, 0);
-    ++negative_id_tmp;
-    if (!d_database.exec("UPDATE sms SET _id = ? WHERE _id = ?", {-1 * negative_id_tmp, oldid}))
-      return false;
-    if (d_database.containsTable("msl_message"))
-      if (!d_database.exec("UPDATE msl_message SET message_id = ? WHERE message_id = ?"s + (d_database.tableContainsColumn("msl_message", "is_mms") ? " AND is_mms IS NOT 1" : ""), {-1 * negative_id_tmp, oldid}))
-        return false;
-    if (d_database.containsTable("reaction")) // dbv >= 121
-      if (!d_database.exec("UPDATE reaction SET message_id = ? WHERE message_id = ?"s + (d_database.tableContainsColumn("reaction", "is_mms") ? " AND is_mms IS NOT 1" : ""), {-1 * negative_id_tmp, oldid}))
-        return false;
-    }
-
-    if (!d_database.exec("UPDATE sms SET _id = _id * -1 WHERE _id < 0"))
+    std::string msl_is_not_mms(d_database.tableContainsColumn("msl_message", "is_mms") ? " AND is_mms IS NOT 1" : "");
+    std::string reaction_is_not_mms(d_database.tableContainsColumn("reaction", "is_mms") ? " AND is_mms IS NOT 1" : "");
+    if (!reorder("sms", d_sms_date_received, {{"msl_message.message_id", msl_is_not_mms},
+                                               {"reaction.message_id", reaction_is_not_mms}}))
       return false;
-    if (d_database.containsTable("msl_message"))
-      if (!d_database.exec("UPDATE msl_message SET message_id = message_id * -1 WHERE message_id < 0"s + (d_database.tableContainsColumn("msl_message", "is_mms") ? " AND is_mms IS NOT 1" : "")))
-        return false;
-    if (d_database.containsTable("reaction")) // dbv >= 121
-      if (!d_database.exec("UPDATE reaction SET message_id = message_id * -1 WHERE message_id < 0"s + (d_database.tableContainsColumn("reaction", "is_mms") ? " AND is_mms IS NOT 1" : "")))
-        return false;
   }
   return true;
 }
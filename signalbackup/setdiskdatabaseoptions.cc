@@ -0,0 +1,55 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+void SignalBackup::setDiskDatabaseOptions() const
+{
+  // the directory SQLite creates its temporary files in (see unixTempFileDir() and winGetTempname()
+  // in sqlite3.c)
+  std::string tmpdir;
+#if defined(_WIN32) || defined(__MINGW64__)
+  std::error_code ec;
+  tmpdir = std::filesystem::temp_directory_path(ec).string();
+#else
+  for (char const *dir : std::initializer_list<char const *>{std::getenv("SQLITE_TMPDIR"), std::getenv("TMPDIR"), "/var/tmp", "/usr/tmp", "/tmp", "."})
+  {
+    std::error_code ec;
+    if (dir && std::filesystem::is_directory(dir, ec))
+    {
+      tmpdir = dir;
+      break;
+    }
+  }
+#endif
+  std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off
+            << " : Keeping the decrypted database in a temporary file in '"
+            << (tmpdir.empty() ? "(unknown)" : tmpdir) << "'. This file is removed when the program exits." << std::endl;
+
+  // The database is thrown away when the program exits, so it does not need to survive a
+  // crash. The rollback journal is left as is (no WAL): some operations roll back savepoints.
+  // SQLite does not memory map temporary databases, the page cache is used instead.
+  uint64_t cachesize = bepaald::physicalMemory() / 4;
+  if (cachesize == 0)
+    cachesize = 256 * 1024 * 1024;
+  if (!d_database.exec("PRAGMA synchronous = OFF") ||
+      !d_database.exec("PRAGMA temp_store = FILE") ||
+      !d_database.exec("PRAGMA cache_size = -" + bepaald::toString(cachesize / 1024))) // negative: size in KiB
+    std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Failed to set options for database" << std::endl;
+}
@@ -44,6 +44,7 @@
 struct HTMLMessageInfo;
 struct Range;
 struct GroupInfo;
+class EmojiTrie;
 enum class IconType;
 
 class SignalBackup
@@ -51,7 +52,16 @@ class SignalBackup
  public:
   static bool constexpr DROPATTACHMENTDATA = false;
 
+  enum IntegrityCheck : int
+  {
+    NOCHECK = 0,
+    FOREIGNKEYCHECK = 1, // only check foreign key constraints
+    QUICKCHECK = 2,      // foreign keys + sqlite's quick_check
+    FULLCHECK = 3,       // foreign keys + sqlite's (full) integrity_check
+  };
+
  private:
+  bool d_databaseondisk; // if set, d_database is a temporary file instead of an in-memory database
   SqliteDB d_database;
   std::unique_ptr<FileDecryptor> d_fd;
   FileEncryptor d_fe;
@@ -93,6 +103,8 @@ class SignalBackup
   std::vector<std::unique_ptr<KeyValueFrame>> d_keyvalueframes;
   std::unique_ptr<EndFrame> d_endframe;
   std::vector<std::pair<uint32_t, uint64_t>> d_badattachments;
+  std::map<std::string, uint64_t> d_schemaorder; // maps CREATE-statements read from file to their position in that file
+  std::string d_integritycachekey; // identifies the input in the cache of integrity checks (empty: do not cache)
   bool d_ok;
   unsigned int d_databaseversion;
   bool d_showprogress;
@@ -171,17 +183,36 @@ class SignalBackup
     bool hasavatar;
   };
 
+  struct CaseFoldRange
+  {
+    uint32_t first;
+    uint32_t last;
+    int32_t delta;
+    uint32_t stride;
+  };
+
+  struct CaseFoldExpansion
+  {
+    uint32_t codepoint;
+    uint32_t folded[3];
+  };
+
   static char const *const s_emoji_unicode_list[3655];
-  static std::unordered_set<char> const s_emoji_first_bytes;
+  static EmojiTrie const s_emoji_trie;
   static unsigned int constexpr s_emoji_min_size = 2; // smallest emoji_unicode_size - 1
   static std::map<std::string, std::string> const s_html_colormap;
+  static CaseFoldRange const s_casefold_ranges[197];
+  static CaseFoldExpansion const s_casefold_expansions[103];
+  static unsigned int constexpr s_searchidx_ngram_size = 3;
 
  public:
   inline SignalBackup(std::string const &filename, std::string const &passphrase, bool verbose,
-                      bool showprogress, bool replaceattachments);
+                      bool showprogress, bool replaceattachments, uint64_t dbondiskthreshold,
+                      IntegrityCheck integritycheck);
   inline SignalBackup(std::string const &filename, std::string const &passphrase, bool verbose,
                       bool showprogress, bool replaceattachment, bool assumebadframesizeonbadmac,
-                      std::vector<long long int> editattachments, bool stoponerror);
+                      std::vector<long long int> editattachments, bool stoponerror, uint64_t dbondiskthreshold,
+                      IntegrityCheck integritycheck);
   [[nodiscard]] inline bool exportBackup(std::string const &filename, std::string const &passphrase,
                                          bool overwrite, bool keepattachmentdatainmemory, bool onlydb = false);
   bool exportXml(std::string const &filename, bool overwrite, std::string self, bool includemms = false, bool keepattachmentdatainmemory = true) const;
@@ -196,7 +227,7 @@ class SignalBackup
   void addSMSMessage(std::string const &body, std::string const &address, long long int timestamp,
                      long long int thread, bool incoming);
   bool importThread(SignalBackup *source, long long int thread);
-  //bool importThread(SignalBackup *source, std::vector<long long int> const &threads);
+  bool importThread(SignalBackup *source, std::vector<long long int> const &threads);
   inline bool ok() const;
   bool dropBadFrames();
   //void fillThreadTableFromMessages();
@@ -210,7 +241,7 @@ class SignalBackup
   //bool importWAChat(std::string const &file, std::string const &fmt, std::string const &self = std::string());
   bool summarize() const;
   bool reorderMmsSmsIds() const;
-  bool dumpMedia(std::string const &dir, std::vector<long long int> const &threads, bool overwrite) const;
+  bool dumpMedia(std::string const &dir, std::vector<long long int> const &threads, bool overwrite, long long int jobs) const;
   bool dumpAvatars(std::string const &dir, std::vector<std::string> const &contacts, bool overwrite) const;
   bool deleteAttachments(std::vector<long long int> const &threadids, std::string const &before,
                          std::string const &after, long long int filesize,
@@ -222,11 +253,11 @@ class SignalBackup
   bool importFromDesktop(std::string configdir, std::string appdir, long long int dbversion,
                          std::vector<std::string> const &dateranges, bool createmissingcontacts,
                          bool autodates, bool ignorewal, std::string const &selfphone);
-  bool checkDbIntegrity(bool warn = false) const;
+  bool checkDbIntegrity(bool warn = false, IntegrityCheck level = FULLCHECK) const;
   bool exportHtml(std::string const &directory, std::vector<long long int> const &threads,
                   std::vector<std::string> const &dateranges, long long int split, std::string const &selfid,
                   bool calllog, bool searchpage, bool migrate, bool overwrite, bool append, bool theme,
-                  bool themeswitching) const;
+                  bool themeswitching, long long int jobs) const;
   bool exportTxt(std::string const &directory, std::vector<long long int> const &threads,
                  std::vector<std::string> const &dateranges, std::string const &selfid, bool migrate, bool overwrite) const;
   bool findRecipient(long long int id) const;
@@ -249,7 +280,7 @@ class SignalBackup
   [[nodiscard]] bool exportBackupToFile(std::string const &filename, std::string const &passphrase,
                                         bool overwrite, bool keepattachmentdatainmemory);
   [[nodiscard]] bool exportBackupToDir(std::string const &directory, bool overwrite, bool keepattachmentdatainmemory, bool onlydb);
-  void initFromFile();
+  void initFromFile(std::string const &filename);
   void initFromDir(std::string const &inputdir, bool replaceattachments);
   void updateThreadsEntries(long long int thread = -1);
   long long int getMaxUsedId(std::string const &table, std::string const &col = "_id") const;
@@ -310,6 +341,11 @@ class SignalBackup
   std::string sanitizeFilename(std::string const &filename) const;
   bool setColumnNames();
   void dtSetColumnNames(SqliteDB *ddb);
+  static bool useDiskDatabase(std::string const &filename, uint64_t threshold);
+  void setDiskDatabaseOptions() const;
+  void checkDbIntegrityOnOpen(IntegrityCheck level, bool replaceattachments, bool assumebadframesizeonbadmac,
+                              std::vector<long long int> const &editattachments) const;
+  static std::string integrityCacheFile();
   long long int scanSelf() const;
   bool cleanAttachments();
   AttachmentMetadata getAttachmentMetaData(std::string const &filename) const;
@@ -380,6 +416,9 @@ class SignalBackup
                       std::map<long long int, RecipientInfo> *recipientinfo, long long int notetoself_tid, bool calllog,
                       bool searchpage, bool overwrite, bool append, bool light, bool themeswitching) const;
   void HTMLwriteSearchpage(std::string const &dir, bool light, bool themeswitching) const;
+  std::set<std::string> HTMLsearchTerms(std::string const &body) const;
+  bool HTMLwriteSearchIndexTerms(std::string const &directory, std::unordered_map<std::string, std::vector<unsigned int>> const &terms,
+                                 std::ofstream &searchidx) const;
   void HTMLwriteCallLog(std::vector<long long int> const &threads, std::string const &directory,
                         std::map<long long int, RecipientInfo> *recipientinfo, long long int notetoself_tid,
                         bool overwrite, bool append, bool light, bool themeswitching) const;
@@ -416,16 +455,20 @@ class SignalBackup
 };
 
 inline SignalBackup::SignalBackup(std::string const &filename, std::string const &passphrase,
-                                  bool verbose, bool showprogress, bool replaceattachments)
+                                  bool verbose, bool showprogress, bool replaceattachments, uint64_t dbondiskthreshold,
+                                  IntegrityCheck integritycheck)
   :
-  SignalBackup(filename, passphrase, verbose, showprogress, replaceattachments, false, std::vector<long long int>(), false)
+  SignalBackup(filename, passphrase, verbose, showprogress, replaceattachments, false, std::vector<long long int>(), false,
+               dbondiskthreshold, integritycheck)
 {}
 
 inline SignalBackup::SignalBackup(std::string const &filename, std::string const &passphrase, bool verbose,
                                   bool showprogress, bool replaceattachments, bool assumebadframesizeonbadmac,
-                                  std::vector<long long int> editattachments, bool stoponerror)
+                                  std::vector<long long int> editattachments, bool stoponerror, uint64_t dbondiskthreshold,
+                                  IntegrityCheck integritycheck)
   :
-  d_database(":memory:"),
+  d_databaseondisk(useDiskDatabase(filename, dbondiskthreshold)),
+  d_database(d_databaseondisk ? "" : ":memory:", false /*readonly*/), // "" = temporary file, deleted on close
   d_passphrase(passphrase),
   d_found_sqlite_sequence_in_backup(false),
   d_ok(false),
@@ -435,12 +478,15 @@ inline SignalBackup::SignalBackup(std::string const &filename, std::string const
   d_verbose(verbose),
   d_selfid(-1)
 {
+  if (d_databaseondisk)
+    setDiskDatabaseOptions();
+
   if (bepaald::isDir(filename))
     initFromDir(filename, replaceattachments);
   else // not directory
   {
     d_fd.reset(new FileDecryptor(filename, passphrase, d_verbose, stoponerror, assumebadframesizeonbadmac, editattachments));
-    initFromFile();
+    initFromFile(filename);
   }
 
   if (d_ok) // set by initfrom()
@@ -448,7 +494,7 @@ inline SignalBackup::SignalBackup(std::string const &filename, std::string const
 
   std::cout << "Database version: " << d_databaseversion << std::endl;
 
-  checkDbIntegrity(true);
+  checkDbIntegrityOnOpen(integritycheck, replaceattachments, assumebadframesizeonbadmac, editattachments);
 }
 
 inline bool SignalBackup::exportBackup(std::string const &filename, std::string const &passphrase, bool overwrite,
@@ -3677,4 +3677,4 @@ char const *const SignalBackup::s_emoji_unicode_list[3655] = {"\xf0\x9f\x91\xa8\
                                                               "\xe2\x9a\xa1",
                                                               "\xe2\x9b\x84"}; // static
 
-std::unordered_set<char> const SignalBackup::s_emoji_first_bytes({'\x23', '\x2a', '\x30', '\x31', '\x32', '\x33', '\x34', '\x35', '\x36', '\x37', '\x38', '\x39', '\xc2', '\xe2', '\xe3', '\xf0'}); // static
+EmojiTrie const SignalBackup::s_emoji_trie(s_emoji_unicode_list); // static
@@ -0,0 +1,43 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "signalbackup.ih"
+
+/*
+  Decides whether the working database should be a temporary file instead of
+  an in-memory database: this is the case when the input (the backup file, or
+  the database of an unpacked backup directory) is larger than threshold bytes.
+  Note the size of a backup file includes its attachments. A threshold of 0
+  always uses a file, by default (no --dbondisk) the threshold is the maximum,
+  so a file is never used.
+*/
+bool SignalBackup::useDiskDatabase(std::string const &filename, uint64_t threshold)
+{
+  if (threshold == 0)
+    return true;
+
+  std::error_code ec;
+  std::uintmax_t inputsize = std::filesystem::is_directory(filename, ec) ?
+    std::filesystem::file_size(filename + "/database.sqlite", ec) :
+    std::filesystem::file_size(filename, ec);
+  if (ec)
+    return false;
+
+  return inputsize > threshold;
+}
@@ -22,7 +22,7 @@
 bool SignalBackup::writeEncryptedFrameWithoutAttachment(std::ofstream &outputfile, std::pair<unsigned char *, uint64_t> framedata)
 {
   // write frame (the non-attachmentdata part)
-  std::pair<unsigned char *, uint64_t> encryptedframe = d_fe.encryptFrame(framedata);
+  std::pair<unsigned char const *, uint64_t> encryptedframe = d_fe.encryptFrame(framedata); // owned by d_fe
   delete[] framedata.first;
 
   if (!encryptedframe.first)
@@ -30,9 +30,8 @@ bool SignalBackup::writeEncryptedFrameWithoutAttachment(std::ofstream &outputfil
     std::cout << "Failed to encrypt framedata" << std::endl;
     return false;
   }
-  bool writeok = !(outputfile.write(reinterpret_cast<char *>(encryptedframe.first), encryptedframe.second)).fail();
+  bool writeok = !(outputfile.write(reinterpret_cast<char const *>(encryptedframe.first), encryptedframe.second)).fail();
 
-  delete[] encryptedframe.first;
   if (!writeok)
     std::cout << "Failed to write encrypted frame data to file" << std::endl;
 
@@ -53,46 +52,52 @@ bool SignalBackup::writeEncryptedFrame(std::ofstream &outputfile, BackupFrame *f
   {
     FrameWithAttachment *f = reinterpret_cast<FrameWithAttachment *>(frame);
 
-    bool badmac = false;
+    // if the attachment turns out to be corrupted, it is only noticed after it is written.
+    // the frame is then skipped by rewinding the output to here (and restoring the iv counter)
+    std::streampos framestart = outputfile.tellp();
+    uint64_t counter = d_fe.counter();
 
-    unsigned char *attachmentdata = f->attachmentData(&badmac);
+    if (!writeEncryptedFrameWithoutAttachment(outputfile, framedata))
+      return false;
 
-    if (!attachmentdata)
+    // write attachment data, it is decrypted, re-encrypted and written in chunks
+    // so the complete attachment is never in memory
+    if (!d_fe.encryptAttachmentInit())
+      return false;
+    uint32_t const BUFFERSIZE = 1024 * 1024;
+    std::unique_ptr<unsigned char[]> encrypteddata(new unsigned char[std::min(attachmentsize, BUFFERSIZE)]);
+    int result = f->streamAttachmentData([&](unsigned char const *data, uint32_t size)
     {
-      delete[] framedata.first;
-      if (badmac)
+      for (uint32_t pos = 0; pos < size; pos += BUFFERSIZE)
       {
-        std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Corrupted data encountered. Skipping frame." << std::endl;
-        return true;
+        uint32_t chunksize = std::min(size - pos, BUFFERSIZE);
+        if (!d_fe.encryptAttachmentUpdate(data + pos, chunksize, encrypteddata.get()) ||
+            !outputfile.write(reinterpret_cast<char *>(encrypteddata.get()), chunksize))
+          return false;
       }
-      return false;
-    }
+      return true;
+    });
 
-    if (!writeEncryptedFrameWithoutAttachment(outputfile, framedata))
+    if (result == -1) [[unlikely]] // bad mac
     {
-      delete[] framedata.first;
-      return false;
+      outputfile.seekp(framestart);
+      d_fe.setCounter(counter);
+      std::cout << bepaald::bold_on << "WARNING" << bepaald::bold_off << " : Corrupted data encountered. Skipping frame." << std::endl;
+      return outputfile.good();
     }
 
-    // write attachment data
-    std::pair<unsigned char *, uint64_t> newdata = d_fe.encryptAttachment(attachmentdata, attachmentsize);
-    //std::cout << "Writing attachment data..." << std::endl;
-    outputfile.write(reinterpret_cast<char *>(newdata.first), newdata.second);
-    delete[] newdata.first;
-
-    if (!outputfile.good())
+    unsigned char mac[FileEncryptor::MACSIZE];
+    if (result != 0 ||
+        !d_fe.encryptAttachmentFinal(mac) ||
+        !outputfile.write(reinterpret_cast<char *>(mac), FileEncryptor::MACSIZE))
     {
       std::cout << "Failed to write encrypted attachmentdata to file" << std::endl;
-      delete[] framedata.first;
       return false;
     }
   }
-  else // not an attachmentframe, write it
+  else // not an attachmentframe, write it (this also frees framedata)
     if (!writeEncryptedFrameWithoutAttachment(outputfile, framedata))
-    {
-      delete[] framedata.first;
       return false;
-    }
 
   return true;
 }
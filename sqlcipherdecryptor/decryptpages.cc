@@ -0,0 +1,134 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlcipherdecryptor.ih"
+
+#include <sstream>
+
+/*
+  PAGE
+
+                                                       page_size
+   -------------------------------------------------------------------------------------------------------------------------------
+  /                                                                     real_page_size                                            \
+  |                                 -----------------------------------------------------------------------------------------------|
+  |                                /                                                                                               |
+  |                                |                                                                                               |
+  |                                |     page + (real_page_size - (digest_size + page_padding) - iv_size)                          |
+  |                                |                v                                                                              |
+
+  [salt, 16 bytes, only first page][encrypted bytes][iv, 16 bytes][mac, padded to 16 bytes (for version < 3, 20 bytes, padded to 32]
+
+*/
+
+// verifies and decrypts (in place, in d_decrypteddata) chunks of pages until all pages
+// are taken or any worker has failed. The contexts are created once per worker.
+void SqlCipherDecryptor::decryptPages(std::atomic<uint64_t> *nextpage, uint64_t numpages, std::atomic<bool> *failed, std::string *message) const
+{
+  unsigned int iv_size = 16;
+  unsigned int page_padding = (((d_digestsize - 1) | 15) + 1) - d_digestsize;  // pad to multiple of 16 bytes ??? (maybe 32?)
+  std::unique_ptr<unsigned char[]> calculatedmac(new unsigned char[d_digestsize]);
+
+  // decryption and mac contexts
+  std::unique_ptr<EVP_CIPHER_CTX, decltype(&::EVP_CIPHER_CTX_free)> dctx(EVP_CIPHER_CTX_new(), &::EVP_CIPHER_CTX_free);
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+  std::unique_ptr<EVP_MAC, decltype(&::EVP_MAC_free)> mac(EVP_MAC_fetch(nullptr, "hmac", nullptr), &::EVP_MAC_free);
+  std::unique_ptr<EVP_MAC_CTX, decltype(&::EVP_MAC_CTX_free)> hctx(EVP_MAC_CTX_new(mac.get()), &::EVP_MAC_CTX_free);
+  OSSL_PARAM params[] = {OSSL_PARAM_construct_utf8_string("digest", d_digestname, 0), OSSL_PARAM_construct_end()};
+#else
+  std::unique_ptr<HMAC_CTX, decltype(&::HMAC_CTX_free)> hctx(HMAC_CTX_new(), &::HMAC_CTX_free);
+#endif
+
+  uint64_t firstpage;
+  while (!*failed && (firstpage = nextpage->fetch_add(s_pagesperchunk)) < numpages)
+  {
+    for (uint64_t p = firstpage; p < std::min(firstpage + s_pagesperchunk, numpages); ++p)
+    {
+      uint32_t pagenumber = p + 1;
+      unsigned int real_page_size = pagenumber == 1 ? d_pagesize - d_saltsize : d_pagesize;
+
+      // these pointers all point to specific data inside 'page'. Because the salt and the sqlite
+      // header are the same size, this is also where the decrypted page is written
+      unsigned char *page = d_decrypteddata + p * d_pagesize + (pagenumber == 1 ? d_saltsize : 0);
+      unsigned char *page_data_to_hash = page;
+      unsigned int page_data_to_hash_size = real_page_size - (d_digestsize + page_padding);
+      unsigned char *iv = page + page_data_to_hash_size - iv_size;
+      unsigned char *page_encrypted_data = page;
+      unsigned int page_encrypted_data_size = page_data_to_hash_size - iv_size;
+
+      // calculate MAC
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+      if (EVP_MAC_init(hctx.get(), d_hmackey, d_hmackeysize, params) != 1 ||
+          EVP_MAC_update(hctx.get(), page_data_to_hash, page_data_to_hash_size) != 1 ||
+          EVP_MAC_update(hctx.get(), reinterpret_cast<unsigned char *>(&pagenumber), sizeof(pagenumber)) != 1 ||
+          EVP_MAC_final(hctx.get(), calculatedmac.get(), nullptr, d_digestsize) != 1)
+#else
+      unsigned int digestsize = d_digestsize;
+      if (HMAC_Init_ex(hctx.get(), d_hmackey, d_hmackeysize, d_digest, nullptr) != 1 ||
+          HMAC_Update(hctx.get(), page_data_to_hash, page_data_to_hash_size) != 1 ||
+          HMAC_Update(hctx.get(), reinterpret_cast<unsigned char *>(&pagenumber), sizeof(pagenumber)) != 1 ||
+          HMAC_Final(hctx.get(), calculatedmac.get(), &digestsize) != 1)
+#endif
+      {
+        *message += "Failed to initialize/update/finalize hmac\n";
+        *failed = true;
+        return;
+      }
+      if (std::memcmp(page + page_data_to_hash_size, calculatedmac.get(), d_digestsize) != 0)
+      {
+        std::ostringstream msg;
+        msg << "MAC in file: " << bepaald::bytesToHexString(page + page_data_to_hash_size, d_digestsize) << std::endl;
+        msg << "Calculated : " << bepaald::bytesToHexString(calculatedmac.get(), d_digestsize) << std::endl;
+        msg << "BAD MAC! (pagenumber: " << pagenumber << ")" << std::endl;
+        *message += msg.str();
+        *failed = true;
+        return;
+      }
+
+      // init decryptor (this copies the iv, so the page can be overwritten)
+      if (EVP_DecryptInit_ex(dctx.get(), EVP_aes_256_cbc(), nullptr, d_key, iv) != 1)
+      {
+        *message += "CTX INIT FAILED\n";
+        *failed = true;
+        return;
+      }
+
+      // disable padding
+      EVP_CIPHER_CTX_set_padding(dctx.get(), 0);
+
+      int actualdecodedframelength = 0;
+      if (EVP_DecryptUpdate(dctx.get(), page, &actualdecodedframelength, page_encrypted_data, page_encrypted_data_size) != 1)
+      {
+        *message += "Failed to update decryption context\n";
+        ERR_print_errors_fp(stderr);
+        *failed = true;
+        return;
+      }
+
+      // reset decryptor
+      if (EVP_CIPHER_CTX_reset(dctx.get()) != 1)
+      {
+        *message += "CTX RESET FAILED\n";
+        *failed = true;
+        return;
+      }
+      std::memset(page + page_encrypted_data_size, 0, real_page_size - page_encrypted_data_size); // zero iv and mac
+    }
+  }
+}
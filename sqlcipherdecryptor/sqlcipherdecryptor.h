@@ -22,6 +22,7 @@
 
 #include <string>
 #include <fstream>
+#include <atomic>
 
 #include "../common_be.h"
 
@@ -50,6 +51,8 @@ class SqlCipherDecryptor
   static unsigned char constexpr s_saltmask = 0x3a;
   static int constexpr s_sqlliteheader_size = 16;
   static char constexpr s_sqlliteheader[s_sqlliteheader_size] = {'S', 'Q', 'L', 'i', 't', 'e', ' ', 'f', 'o', 'r', 'm', 'a', 't', ' ', '3', '\0'};
+  static unsigned int constexpr s_maxworkers = 8;
+  static uint64_t constexpr s_pagesperchunk = 256; // pages handed to a worker at once
 
   struct DecodedData
   {
@@ -69,6 +72,7 @@ class SqlCipherDecryptor
   bool getKey();
   bool getHmacKey();
   bool decryptData(std::ifstream *dbfile);
+  void decryptPages(std::atomic<uint64_t> *nextpage, uint64_t numpages, std::atomic<bool> *failed, std::string *message) const;
 };
 
 inline bool SqlCipherDecryptor::ok() const
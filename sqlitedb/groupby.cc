@@ -0,0 +1,81 @@
+/*
+  Copyright (C) 2023  Selwin van Dijk
+
+  This file is part of signalbackup-tools.
+
+  signalbackup-tools is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  signalbackup-tools is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with signalbackup-tools.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "sqlitedb.ih"
+
+/*
+  Splits the results into a set of results per (integer) value of column
+  `header'. The grouping column itself is left out, the order of the rows
+  within a group is kept. Rows where `header' is not an integer are skipped.
+*/
+std::unordered_map<long long int, SqliteDB::QueryResults> SqliteDB::QueryResults::groupBy(std::string const &header) const
+{
+  std::unordered_map<long long int, QueryResults> groups;
+
+  int keyidx = idxOfHeader(header);
+  if (keyidx == -1) [[unlikely]]
+  {
+    std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off
+              << ": Column `" << header << "' not found in query results" << std::endl;
+    return groups;
+  }
+
+  for (uint i = 0; i < d_rows; ++i)
+  {
+    if (!valueHasType<long long int>(i, keyidx))
+      continue;
+
+    QueryResults &group = groups[getValueAs<long long int>(i, keyidx)];
+    if (group.columns() == 0)
+      for (uint j = 0; j < d_headers.size(); ++j)
+        if (static_cast<int>(j) != keyidx)
+          group.emplaceHeader(std::string(d_headers[j]));
+
+    size_t row = group.rows();
+    for (uint j = 0; j < d_columns.size(); ++j)
+    {
+      if (static_cast<int>(j) == keyidx)
+        continue;
+
+      Cell const &cell = d_columns[j][i];
+      switch (cell.type)
+      {
+        case CellType::INTEGER:
+          group.emplaceInteger(row, cell.integer);
+          break;
+        case CellType::REAL:
+          group.emplaceReal(row, cell.real);
+          break;
+        case CellType::TEXT:
+          group.emplaceText(row, d_textarena.data() + cell.textoffset, cell.size);
+          break;
+        case CellType::BLOB:
+          group.emplaceBlob(row, d_blobchunks[cell.blob.chunk].get() + cell.blob.offset, cell.size);
+          break;
+        case CellType::OTHER:
+          group.emplaceValue(row, std::any(d_others[cell.otheridx]));
+          break;
+        case CellType::NULLVALUE:
+          group.emplaceNull(row);
+          break;
+      }
+    }
+  }
+  return groups;
+}
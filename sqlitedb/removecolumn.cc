@@ -23,13 +23,13 @@ bool SqliteDB::QueryResults::removeColumn(uint idx)
 {
   if (idx >= d_headers.size())
     return false;
-  for (auto const &v : d_values)
-    if (idx >= v.size())
-      return false;
+  if (d_rows && (idx >= d_columns.size() || d_columns[idx].size() != d_rows))
+    return false;
 
   d_headers.erase(d_headers.begin() + idx);
-  for (auto &v : d_values)
-    v.erase(v.begin() + idx);
+  if (idx < d_columns.size())
+    d_columns.erase(d_columns.begin() + idx);
+  rebuildHeaderIndex();
 
   return true;
 }
@@ -23,6 +23,12 @@
 #include <sqlite3.h>
 #include <memory>
 #include <vector>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <string_view>
+#include <type_traits>
 #include <iostream>
 #include <any>
 #if __cpp_lib_ranges >= 201911L && !defined(__clang__) // ranges does not currently seem to work with clang
@@ -35,22 +41,71 @@
 class SqliteDB
 {
  public:
+  /*
+    Results are stored per column. Each cell holds its sqlite type and either the
+    value itself (integer, real) or the location of its data in the text- or blob
+    arena. Values that were added as any other type are kept in d_others. The
+    std::any based accessors build their return value from the cell.
+  */
   class QueryResults
   {
+    enum class CellType : unsigned char
+    {
+      NULLVALUE,
+      INTEGER,
+      REAL,
+      TEXT,
+      BLOB,
+      OTHER
+    };
+
+    struct Cell
+    {
+      union
+      {
+        long long int integer;
+        double real;
+        uint64_t textoffset; // into d_textarena
+        struct
+        {
+          uint32_t chunk;    // index into d_blobchunks
+          uint32_t offset;
+        } blob;
+        uint64_t otheridx;   // into d_others
+      };
+      uint32_t size;         // for text and blob
+      CellType type;
+    };
+
+    static uint32_t constexpr s_blobchunk_size = 1024 * 1024;
+
     std::vector<std::string> d_headers;
-    std::vector<std::vector<std::any>> d_values;
+    std::unordered_map<std::string, int> d_headerindex; // first column with name
+    std::vector<std::vector<Cell>> d_columns;
+    size_t d_rows;
+    size_t d_fillcolumn;
+    std::string d_textarena;
+    std::vector<std::shared_ptr<unsigned char []>> d_blobchunks;
+    uint32_t d_blobchunk_used;
+    std::vector<std::any> d_others;
 
    public:
+    inline QueryResults();
     inline void emplaceHeader(std::string &&h);
     inline std::vector<std::string> const &headers() const;
     inline std::string const &header(size_t idx) const;
     inline bool hasColumn(std::string const &h) const;
     inline void emplaceValue(size_t row, std::any &&a);
+    inline void emplaceNull(size_t row);
+    inline void emplaceInteger(size_t row, long long int value);
+    inline void emplaceReal(size_t row, double value);
+    inline void emplaceText(size_t row, char const *text, size_t size);
+    inline void emplaceBlob(size_t row, void const *data, size_t size);
     inline std::any value(size_t row, std::string const &header) const;
     template <typename T>
     inline T getValueAs(size_t row, std::string const &header) const;
-    inline std::any const &value(size_t row, size_t idx) const;
-    inline std::vector<std::any> const &row(size_t row) const;
+    inline std::any value(size_t row, size_t idx) const;
+    inline std::vector<std::any> row(size_t row) const;
     template <typename T>
     inline bool valueHasType(size_t row, size_t idx) const;
     template <typename T>
@@ -63,6 +118,7 @@ class SqliteDB
     inline size_t rows() const;
     inline size_t columns() const;
     inline void clear();
+    inline void clearValues();
     void printLineMode() const;
     void prettyPrint() const;
     void print(bool printheader = true) const;
@@ -77,10 +133,14 @@ class SqliteDB
     bool removeColumn(uint idx);
     inline bool removeRow(uint idx);
     inline QueryResults getRow(uint idx);
+    std::unordered_map<long long int, QueryResults> groupBy(std::string const &header) const;
 
    private:
     //std::wstring wideString(std::string const &narrow) const;
     inline int idxOfHeader(std::string const &header) const;
+    inline void emplaceCell(size_t row, Cell const &cell);
+    inline std::pair<std::shared_ptr<unsigned char []>, size_t> blobValue(Cell const &cell) const;
+    inline void rebuildHeaderIndex();
     //bool supportsAnsi() const;
     //bool isTerminal() const;
     inline bool useEscapeCodes() const;
@@ -88,11 +148,59 @@ class SqliteDB
     inline uint64_t charCount(std::string const &utf8) const;
   };
 
+  /*
+    A statement parameter referring to data owned by the caller, instead of holding a copy
+    like the std::any parameters do. It is bound with SQLITE_STATIC, so the data must stay
+    valid and unchanged until exec() returns.
+  */
+  struct ParameterView
+  {
+    enum class Type : unsigned char
+    {
+      NULLVALUE,
+      INTEGER,
+      REAL,
+      TEXT,
+      BLOB
+    };
+
+    Type type;
+    long long int integervalue;
+    double realvalue;
+    unsigned char const *data;
+    uint64_t size;
+
+    inline static ParameterView null();
+    inline static ParameterView integer(long long int value);
+    inline static ParameterView real(double value);
+    inline static ParameterView text(unsigned char const *data, uint64_t size);
+    inline static ParameterView blob(unsigned char const *data, uint64_t size);
+  };
+
  private:
   sqlite3 *d_db;
   sqlite3_vfs *d_vfs;
   bool d_ok;
 
+  // The connection is opened in serialized mode, and the caches below are guarded by
+  // mutexes, so const member functions (exec() etc.) can be called from several threads.
+
+  // prepared statements, most recently used first. Statements are taken out of
+  // the cache while in use, so a nested exec() of the same query prepares its own.
+  static unsigned int constexpr s_stmtcache_size = 64;
+  mutable std::list<std::pair<std::string, sqlite3_stmt *>> d_stmtcache;
+  mutable std::unordered_map<std::string_view, std::list<std::pair<std::string, sqlite3_stmt *>>::iterator> d_stmtcacheindex;
+  mutable uint64_t d_stmtcache_hits;
+  mutable uint64_t d_stmtcache_misses;
+  mutable std::mutex d_stmtcachemutex;
+
+  // schema info for containsTable() and tableContainsColumn(), filled as needed. It is
+  // cleared whenever a statement that changes the schema is run through exec().
+  mutable std::unordered_set<std::string> d_schemacache_tables;
+  mutable bool d_schemacache_tablesloaded;
+  mutable std::unordered_map<std::string, std::unordered_set<std::string>> d_schemacache_columns;
+  mutable std::mutex d_schemacachemutex;
+
  public:
   inline explicit SqliteDB(std::string const &name, bool readonly = true);
   inline explicit SqliteDB(std::pair<unsigned char *, uint64_t> *data);
@@ -107,6 +215,13 @@ class SqliteDB
   inline bool exec(std::string const &q, R &&params, QueryResults *results = nullptr) const;
 #endif
   inline bool exec(std::string const &q, std::vector<std::any> const &params, QueryResults *results = nullptr) const;
+  inline bool exec(std::string const &q, std::vector<ParameterView> const &params, QueryResults *results = nullptr) const;
+  template <typename F>
+  inline bool execForEach(std::string const &q, F &&callback) const;
+  template <typename F>
+  inline bool execForEach(std::string const &q, std::any const &param, F &&callback) const;
+  template <typename F>
+  inline bool execForEach(std::string const &q, std::vector<std::any> const &params, F &&callback) const;
   template <typename T>
   inline T getSingleResultAs(std::string const &q, T defaultval) const;
   template <typename T>
@@ -130,8 +245,25 @@ class SqliteDB
   template <typename... columnnames>
   inline bool tableContainsColumn(std::string const &tablename, std::string const &columnname, columnnames... list) const;
   inline void freeMemory();
+  inline uint64_t statementCacheHits() const;
+  inline uint64_t statementCacheMisses() const;
 
  private:
+#if __cpp_lib_ranges >= 201911L && !defined(__clang__)
+  template <typename R, typename F> requires std::ranges::input_range<R> && std::is_same<std::any, std::ranges::range_value_t<R>>::value
+  inline bool execRows(std::string const &q, R &&params, F &&rowhandler) const;
+#else
+  template <typename F>
+  inline bool execRows(std::string const &q, std::vector<std::any> const &params, F &&rowhandler) const;
+#endif
+  template <typename F>
+  inline bool stepRows(std::string const &q, sqlite3_stmt *stmt, F &&rowhandler) const;
+  inline void emplaceRow(sqlite3_stmt *stmt, int row, QueryResults *results) const;
+  inline sqlite3_stmt *prepareStatement(std::string const &q) const;
+  inline void releaseStatement(std::string const &q, sqlite3_stmt *stmt) const;
+  inline void clearStatementCache() const;
+  inline bool changesSchema(sqlite3_stmt *stmt) const;
+  inline void clearSchemaCache() const;
   inline int execParamFiller(sqlite3_stmt *stmt, int count, std::string const &param) const;
   inline int execParamFiller(sqlite3_stmt *stmt, int count, int param) const;
   inline int execParamFiller(sqlite3_stmt *stmt, int count, unsigned int param) const;
@@ -142,6 +274,7 @@ class SqliteDB
   inline int execParamFiller(sqlite3_stmt *stmt, int count, std::pair<std::shared_ptr<unsigned char []>, size_t> const &param) const;
   inline int execParamFiller(sqlite3_stmt *stmt, int count, std::pair<unsigned char *, size_t> const &param) const;
   inline int execParamFiller(sqlite3_stmt *stmt, int count, std::nullptr_t param) const;
+  inline int execParamFiller(sqlite3_stmt *stmt, int count, ParameterView const &param) const;
   template <typename T>
   inline bool isType(std::any const &a) const;
 
@@ -154,12 +287,15 @@ inline SqliteDB::SqliteDB(std::string const &name, bool readonly)
   :
   d_db(nullptr),
   d_vfs(nullptr),
-  d_ok(false)
+  d_ok(false),
+  d_stmtcache_hits(0),
+  d_stmtcache_misses(0),
+  d_schemacache_tablesloaded(false)
 {
   if (name != ":memory:" && readonly)
     d_ok = (sqlite3_open_v2(name.c_str(), &d_db, SQLITE_OPEN_READONLY, nullptr) == SQLITE_OK);
   else
-    d_ok = (sqlite3_open(name.c_str(), &d_db) == SQLITE_OK);
+    d_ok = (sqlite3_open_v2(name.c_str(), &d_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX, nullptr) == SQLITE_OK);
 
   if (d_ok)
     d_ok = registerCustoms();
@@ -169,7 +305,10 @@ inline SqliteDB::SqliteDB(std::pair<unsigned char *, uint64_t> *data)
   :
   d_db(nullptr),
   d_vfs(MemFileDB::sqlite3_memfilevfs(data)),
-  d_ok(false)
+  d_ok(false),
+  d_stmtcache_hits(0),
+  d_stmtcache_misses(0),
+  d_schemacache_tablesloaded(false)
 {
   if (sqlite3_vfs_register(d_vfs, 0) == SQLITE_OK)
     d_ok = (sqlite3_open_v2(MemFileDB::vfsName(), &d_db, SQLITE_OPEN_READONLY, MemFileDB::vfsName()) == SQLITE_OK);
@@ -180,6 +319,8 @@ inline SqliteDB::SqliteDB(std::pair<unsigned char *, uint64_t> *data)
 
 inline SqliteDB::~SqliteDB()
 {
+  clearStatementCache();
+
   if (d_db)
     sqlite3_close(d_db);
 
@@ -209,8 +350,30 @@ inline bool SqliteDB::exec(std::string const &q, R &&params, QueryResults *resul
 inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &params, QueryResults *results) const
 #endif
 {
-  sqlite3_stmt *stmt;
-  if (sqlite3_prepare_v2(d_db, q.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+  if (results)
+    results->clear();
+  int row = 0;
+  return execRows(q, params, [&](sqlite3_stmt *stmt)
+  {
+    if (results)
+      emplaceRow(stmt, row++, results);
+    return true;
+  });
+}
+
+// binds params, then calls rowhandler(stmt) for every result row. If the rowhandler returns
+// false, stepping is stopped and false is returned.
+#if __cpp_lib_ranges >= 201911L && !defined(__clang__)
+template <typename R, typename F> requires std::ranges::input_range<R> && std::is_same<std::any, std::ranges::range_value_t<R>>::value
+inline bool SqliteDB::execRows(std::string const &q, R &&params, F &&rowhandler) const
+#else
+template <typename F>
+inline bool SqliteDB::execRows(std::string const &q, std::vector<std::any> const &params, F &&rowhandler) const
+#endif
+{
+  auto release = [this, &q](sqlite3_stmt *s) { releaseStatement(q, s); };
+  std::unique_ptr<sqlite3_stmt, decltype(release)> stmt(prepareStatement(q), release);
+  if (!stmt)
   {
     std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
       "During sqlite3_prepare_v2(): " << sqlite3_errmsg(d_db) << std::endl <<
@@ -218,14 +381,17 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
     return false;
   }
 
-  if (static_cast<int>(params.size()) != sqlite3_bind_parameter_count(stmt)) [[unlikely]]
+  if (changesSchema(stmt.get())) [[unlikely]]
+    clearSchemaCache();
+
+  if (static_cast<int>(params.size()) != sqlite3_bind_parameter_count(stmt.get())) [[unlikely]]
   {
-    if (sqlite3_bind_parameter_count(stmt) < static_cast<int>(params.size()))
+    if (sqlite3_bind_parameter_count(stmt.get()) < static_cast<int>(params.size()))
       std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << ": " << "Too few placeholders in query!";
-    else if (sqlite3_bind_parameter_count(stmt) > static_cast<int>(params.size()))
+    else if (sqlite3_bind_parameter_count(stmt.get()) > static_cast<int>(params.size()))
       std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << ": " << "Too many placeholders in query!";
     std::cout << " \"" << q << "\" (parameters: " << params.size()
-              << ", placeholders: " << sqlite3_bind_parameter_count(stmt) << ")" << std::endl;
+              << ", placeholders: " << sqlite3_bind_parameter_count(stmt.get()) << ")" << std::endl;
   }
 
 #if __cplusplus > 201703L
@@ -237,7 +403,7 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
   {
     if (isType<std::nullptr_t>(p))
     {
-      if (execParamFiller(stmt, i + 1, nullptr) != SQLITE_OK)
+      if (execParamFiller(stmt.get(), i + 1, nullptr) != SQLITE_OK)
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
           "During sqlite3_bind_*(): " << sqlite3_errmsg(d_db) << std::endl <<
@@ -247,7 +413,7 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
     }
     else if (isType<double>(p))
     {
-      if (execParamFiller(stmt, i + 1, std::any_cast<double>(p)) != SQLITE_OK)
+      if (execParamFiller(stmt.get(), i + 1, std::any_cast<double>(p)) != SQLITE_OK)
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
           "During sqlite3_bind_*(): " << sqlite3_errmsg(d_db) << std::endl <<
@@ -257,7 +423,7 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
     }
     else if (isType<int>(p))
     {
-      if (execParamFiller(stmt, i + 1, std::any_cast<int>(p)) != SQLITE_OK)
+      if (execParamFiller(stmt.get(), i + 1, std::any_cast<int>(p)) != SQLITE_OK)
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
           "During sqlite3_bind_*(): " << sqlite3_errmsg(d_db) << std::endl <<
@@ -267,7 +433,7 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
     }
     else if (isType<unsigned int>(p))
     {
-      if (execParamFiller(stmt, i + 1, std::any_cast<unsigned int>(p)) != SQLITE_OK)
+      if (execParamFiller(stmt.get(), i + 1, std::any_cast<unsigned int>(p)) != SQLITE_OK)
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
           "During sqlite3_bind_*(): " << sqlite3_errmsg(d_db) << std::endl <<
@@ -277,7 +443,7 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
     }
     else if (isType<long long int>(p))
     {
-      if (execParamFiller(stmt, i + 1, std::any_cast<long long int>(p)) != SQLITE_OK)
+      if (execParamFiller(stmt.get(), i + 1, std::any_cast<long long int>(p)) != SQLITE_OK)
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
           "During sqlite3_bind_*(): " << sqlite3_errmsg(d_db) << std::endl <<
@@ -287,7 +453,7 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
     }
     else if (isType<unsigned long>(p))
     {
-      if (execParamFiller(stmt, i + 1, std::any_cast<unsigned long>(p)) != SQLITE_OK)
+      if (execParamFiller(stmt.get(), i + 1, std::any_cast<unsigned long>(p)) != SQLITE_OK)
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
           "During sqlite3_bind_*(): " << sqlite3_errmsg(d_db) << std::endl <<
@@ -297,7 +463,7 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
     }
     else if (isType<unsigned long long int>(p))
     {
-      if (execParamFiller(stmt, i + 1, std::any_cast<unsigned long long int>(p)) != SQLITE_OK)
+      if (execParamFiller(stmt.get(), i + 1, std::any_cast<unsigned long long int>(p)) != SQLITE_OK)
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
           "During sqlite3_bind_*(): " << sqlite3_errmsg(d_db) << std::endl <<
@@ -307,7 +473,7 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
     }
     else if (isType<std::string>(p))
     {
-      if (execParamFiller(stmt, i + 1, std::any_cast<std::string>(p)) != SQLITE_OK)
+      if (execParamFiller(stmt.get(), i + 1, std::any_cast<std::string>(p)) != SQLITE_OK)
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
           "During sqlite3_bind_*(): " << sqlite3_errmsg(d_db) << std::endl <<
@@ -317,7 +483,7 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
     }
     else if (isType<std::pair<std::shared_ptr<unsigned char []>, size_t>>(p))
     {
-      if (execParamFiller(stmt, i + 1, std::any_cast<std::pair<std::shared_ptr<unsigned char []>, size_t>>(p)) != SQLITE_OK)
+      if (execParamFiller(stmt.get(), i + 1, std::any_cast<std::pair<std::shared_ptr<unsigned char []>, size_t>>(p)) != SQLITE_OK)
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
           "During sqlite3_bind_*(): " << sqlite3_errmsg(d_db) << std::endl <<
@@ -327,7 +493,7 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
     }
     else if (isType<std::pair<unsigned char *, size_t>>(p))
     {
-      if (execParamFiller(stmt, i + 1, std::any_cast<std::pair<unsigned char *, size_t>>(p)) != SQLITE_OK)
+      if (execParamFiller(stmt.get(), i + 1, std::any_cast<std::pair<unsigned char *, size_t>>(p)) != SQLITE_OK)
       {
         std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
           "During sqlite3_bind_*(): " << sqlite3_errmsg(d_db) << std::endl <<
@@ -345,53 +511,67 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
     ++i;
   }
 
+  return stepRows(q, stmt.get(), std::forward<F>(rowhandler));
+}
+
+inline bool SqliteDB::exec(std::string const &q, std::vector<ParameterView> const &params, QueryResults *results) const
+{
   if (results)
     results->clear();
-  int rc;
-  int row = 0;
-  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
-  {
-    if (!results)
-      continue;
-
-    // if headers aren't set, set them
-    if (results->columns() == 0)
-      for (int c = 0; c < sqlite3_column_count(stmt); ++c)
-        results->emplaceHeader(sqlite3_column_name(stmt, c));
 
-    // set values
-    for (int c = 0; c < sqlite3_column_count(stmt); ++c)
-    {
-      if (sqlite3_column_type(stmt, c) == SQLITE_INTEGER)
-        results->emplaceValue(row, sqlite3_column_int64(stmt, c));
-      else if (sqlite3_column_type(stmt, c) == SQLITE_FLOAT)
-        results->emplaceValue(row, sqlite3_column_double(stmt, c));
-      else if (sqlite3_column_type(stmt, c) == SQLITE_TEXT)
-        results->emplaceValue(row, std::string(reinterpret_cast<char const *>(sqlite3_column_text(stmt, c))));
-      else if (sqlite3_column_type(stmt, c) == SQLITE_NULL)
-        results->emplaceValue(row, nullptr);
-      else if (sqlite3_column_type(stmt, c) == SQLITE_BLOB)
-      {
-        size_t blobsize = sqlite3_column_bytes(stmt, c);
-        std::shared_ptr<unsigned char []> blob(new unsigned char[blobsize]);
-        std::memcpy(blob.get(), reinterpret_cast<unsigned char const *>(sqlite3_column_blob(stmt, c)), blobsize);
-        results->emplaceValue(row, std::make_pair(blob, blobsize));
-      }
-    }
-    ++row;
-  }
-  if (rc != SQLITE_DONE)
+  auto release = [this, &q](sqlite3_stmt *s) { releaseStatement(q, s); };
+  std::unique_ptr<sqlite3_stmt, decltype(release)> stmt(prepareStatement(q), release);
+  if (!stmt)
   {
     std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
-      "After sqlite3_step(): " << sqlite3_errmsg(d_db) << std::endl <<
+      "During sqlite3_prepare_v2(): " << sqlite3_errmsg(d_db) << std::endl <<
       "  Query: \"" << q << "\"" << std::endl;
     return false;
   }
 
-  if (sqlite3_finalize(stmt) != SQLITE_OK)
+  if (changesSchema(stmt.get())) [[unlikely]]
+    clearSchemaCache();
+
+  if (static_cast<int>(params.size()) != sqlite3_bind_parameter_count(stmt.get())) [[unlikely]]
+  {
+    if (sqlite3_bind_parameter_count(stmt.get()) < static_cast<int>(params.size()))
+      std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << ": " << "Too few placeholders in query!";
+    else if (sqlite3_bind_parameter_count(stmt.get()) > static_cast<int>(params.size()))
+      std::cout << bepaald::bold_on << "Warning" << bepaald::bold_off << ": " << "Too many placeholders in query!";
+    std::cout << " \"" << q << "\" (parameters: " << params.size()
+              << ", placeholders: " << sqlite3_bind_parameter_count(stmt.get()) << ")" << std::endl;
+  }
+
+  for (unsigned int i = 0; i < params.size(); ++i)
+    if (execParamFiller(stmt.get(), i + 1, params[i]) != SQLITE_OK) [[unlikely]]
+    {
+      std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
+        "During sqlite3_bind_*(): " << sqlite3_errmsg(d_db) << std::endl <<
+        "  Query: \"" << q << "\"" << std::endl;
+      return false;
+    }
+
+  int row = 0;
+  return stepRows(q, stmt.get(), [&](sqlite3_stmt *s)
+  {
+    if (results)
+      emplaceRow(s, row++, results);
+    return true;
+  });
+}
+
+// steps through the results of an already bound statement, calling rowhandler(stmt) for every row
+template <typename F>
+inline bool SqliteDB::stepRows(std::string const &q, sqlite3_stmt *stmt, F &&rowhandler) const
+{
+  int rc;
+  while ((rc = sqlite3_step(stmt)) == SQLITE_ROW)
+    if (!rowhandler(stmt))
+      return false;
+  if (rc != SQLITE_DONE)
   {
     std::cout << bepaald::bold_on << "Error" << bepaald::bold_off << " : " <<
-      "During sqlite3_finalize(): " << sqlite3_errmsg(d_db) << std::endl <<
+      "After sqlite3_step(): " << sqlite3_errmsg(d_db) << std::endl <<
       "  Query: \"" << q << "\"" << std::endl;
     return false;
   }
@@ -406,6 +586,62 @@ inline bool SqliteDB::exec(std::string const &q, std::vector<std::any> const &pa
 }
 #endif
 
+inline void SqliteDB::emplaceRow(sqlite3_stmt *stmt, int row, QueryResults *results) const
+{
+  // if headers aren't set, set them
+  if (results->columns() == 0)
+    for (int c = 0; c < sqlite3_column_count(stmt); ++c)
+      results->emplaceHeader(sqlite3_column_name(stmt, c));
+
+  // set values
+  for (int c = 0; c < sqlite3_column_count(stmt); ++c)
+  {
+    if (sqlite3_column_type(stmt, c) == SQLITE_INTEGER)
+      results->emplaceInteger(row, sqlite3_column_int64(stmt, c));
+    else if (sqlite3_column_type(stmt, c) == SQLITE_FLOAT)
+      results->emplaceReal(row, sqlite3_column_double(stmt, c));
+    else if (sqlite3_column_type(stmt, c) == SQLITE_TEXT)
+    {
+      char const *text = reinterpret_cast<char const *>(sqlite3_column_text(stmt, c));
+      results->emplaceText(row, text, std::strlen(text));
+    }
+    else if (sqlite3_column_type(stmt, c) == SQLITE_NULL)
+      results->emplaceNull(row);
+    else if (sqlite3_column_type(stmt, c) == SQLITE_BLOB)
+      results->emplaceBlob(row, sqlite3_column_blob(stmt, c), sqlite3_column_bytes(stmt, c));
+  }
+}
+
+template <typename F>
+inline bool SqliteDB::execForEach(std::string const &q, F &&callback) const
+{
+  return execForEach(q, std::vector<std::any>(), std::forward<F>(callback));
+}
+
+template <typename F>
+inline bool SqliteDB::execForEach(std::string const &q, std::any const &param, F &&callback) const
+{
+  return execForEach(q, std::vector<std::any>{param}, std::forward<F>(callback));
+}
+
+/*
+  Calls callback(QueryResults const &) for each result row, straight from sqlite3_step(), so
+  the full result set is never held in memory. The QueryResults passed contains only the
+  current row (row 0) and is reused for the next one. If the callback returns false, the
+  query is stopped and execForEach returns false.
+*/
+template <typename F>
+inline bool SqliteDB::execForEach(std::string const &q, std::vector<std::any> const &params, F &&callback) const
+{
+  QueryResults current;
+  return execRows(q, params, [&](sqlite3_stmt *stmt)
+  {
+    current.clearValues();
+    emplaceRow(stmt, 0, &current);
+    return callback(std::as_const(current));
+  });
+}
+
 template <typename T>
 inline T SqliteDB::getSingleResultAs(std::string const &q, T defaultval) const
 {
@@ -544,6 +780,31 @@ inline int SqliteDB::execParamFiller(sqlite3_stmt *stmt, int count, unsigned lon
   return sqlite3_bind_int64(stmt, count, param);
 }
 
+inline int SqliteDB::execParamFiller(sqlite3_stmt *stmt, int count, ParameterView const &param) const
+{
+  switch (param.type)
+  {
+    case ParameterView::Type::INTEGER:
+      return sqlite3_bind_int64(stmt, count, param.integervalue);
+    case ParameterView::Type::REAL:
+      return sqlite3_bind_double(stmt, count, param.realvalue);
+    case ParameterView::Type::TEXT:
+    {
+      if (!param.data) [[unlikely]]
+        return sqlite3_bind_text(stmt, count, "", 0, SQLITE_STATIC);
+      // like the std::string version, the text ends at the first '\0'
+      void const *end = std::memchr(param.data, '\0', param.size);
+      uint64_t size = end ? static_cast<unsigned char const *>(end) - param.data : param.size;
+      return sqlite3_bind_text(stmt, count, reinterpret_cast<char const *>(param.data), size, SQLITE_STATIC);
+    }
+    case ParameterView::Type::BLOB:
+      return sqlite3_bind_blob(stmt, count, param.data, param.size, SQLITE_STATIC);
+    case ParameterView::Type::NULLVALUE:
+    default:
+      return sqlite3_bind_null(stmt, count);
+  }
+}
+
 inline int SqliteDB::execParamFiller(sqlite3_stmt *stmt, int count, std::nullptr_t) const
 {
   //std::cout << "Binding NULL at " << count << std::endl;
@@ -568,18 +829,33 @@ inline long long int SqliteDB::lastInsertRowid() const
 
 inline bool SqliteDB::containsTable(std::string const &tablename) const
 {
-  QueryResults tmp;
-  if (exec("SELECT DISTINCT tbl_name FROM sqlite_master WHERE type = 'table' AND tbl_name = '" + tablename + "'", &tmp))
-    return (tmp.rows() > 0);
-  return false;
+  std::lock_guard<std::mutex> lock(d_schemacachemutex);
+  if (!d_schemacache_tablesloaded)
+  {
+    QueryResults tmp;
+    if (!exec("SELECT DISTINCT tbl_name FROM sqlite_master WHERE type = 'table'", &tmp))
+      return false;
+    for (uint i = 0; i < tmp.rows(); ++i)
+      d_schemacache_tables.insert(tmp.valueAsString(i, 0));
+    d_schemacache_tablesloaded = true;
+  }
+  return d_schemacache_tables.find(tablename) != d_schemacache_tables.end();
 }
 
 inline bool SqliteDB::tableContainsColumn(std::string const &tablename, std::string const &columnname) const
 {
-  QueryResults tmp;
-  if (exec("SELECT 1 FROM PRAGMA_TABLE_XINFO('" + tablename + "') WHERE name == '" + columnname + "'", &tmp))
-    return (tmp.rows() > 0);
-  return false;
+  std::lock_guard<std::mutex> lock(d_schemacachemutex);
+  auto it = d_schemacache_columns.find(tablename);
+  if (it == d_schemacache_columns.end())
+  {
+    QueryResults tmp;
+    if (!exec("SELECT name FROM PRAGMA_TABLE_XINFO('" + tablename + "')", &tmp))
+      return false;
+    it = d_schemacache_columns.emplace(tablename, std::unordered_set<std::string>()).first;
+    for (uint i = 0; i < tmp.rows(); ++i)
+      it->second.insert(tmp.valueAsString(i, 0));
+  }
+  return it->second.find(columnname) != it->second.end();
 }
 
 template <typename... columnnames>
@@ -588,13 +864,144 @@ inline bool SqliteDB::tableContainsColumn(std::string const &tablename, std::str
   return tableContainsColumn(tablename, columnname) && tableContainsColumn(tablename, list...);
 }
 
+// true for CREATE, DROP and ALTER statements, and for ROLLBACK (also ROLLBACK TO a savepoint),
+// which may undo any of those
+inline bool SqliteDB::changesSchema(sqlite3_stmt *stmt) const
+{
+  char const *sql = sqlite3_sql(stmt);
+  if (!sql) [[unlikely]]
+    return false;
+
+  // skip leading whitespace and comments
+  while (true)
+  {
+    while (std::isspace(static_cast<unsigned char>(*sql)))
+      ++sql;
+    if (sql[0] == '-' && sql[1] == '-')
+    {
+      while (*sql && *sql != '\n')
+        ++sql;
+    }
+    else if (sql[0] == '/' && sql[1] == '*')
+    {
+      char const *end = std::strstr(sql + 2, "*/");
+      if (!end)
+        return false;
+      sql = end + 2;
+    }
+    else
+      break;
+  }
+
+  auto startswith = [sql](std::string_view keyword)
+  {
+    for (uint i = 0; i < keyword.size(); ++i)
+      if (std::toupper(static_cast<unsigned char>(sql[i])) != keyword[i]) // sql is null-terminated, stops on mismatch
+        return false;
+    return true;
+  };
+  if (startswith("ROLLBACK")) // transaction control is 'readonly' to sqlite3_stmt_readonly()
+    return true;
+  if (sqlite3_stmt_readonly(stmt))
+    return false;
+  return startswith("CREATE") || startswith("DROP") || startswith("ALTER");
+}
+
+inline void SqliteDB::clearSchemaCache() const
+{
+  std::lock_guard<std::mutex> lock(d_schemacachemutex);
+  d_schemacache_tables.clear();
+  d_schemacache_tablesloaded = false;
+  d_schemacache_columns.clear();
+}
+
 inline void SqliteDB::freeMemory()
 {
+  clearStatementCache();
   sqlite3_db_release_memory(d_db);
 }
 
+inline uint64_t SqliteDB::statementCacheHits() const
+{
+  return d_stmtcache_hits;
+}
+
+inline uint64_t SqliteDB::statementCacheMisses() const
+{
+  return d_stmtcache_misses;
+}
+
+inline sqlite3_stmt *SqliteDB::prepareStatement(std::string const &q) const
+{
+  {
+    std::lock_guard<std::mutex> lock(d_stmtcachemutex);
+    auto it = d_stmtcacheindex.find(q);
+    if (it != d_stmtcacheindex.end())
+    {
+      ++d_stmtcache_hits;
+      auto cached = it->second;
+      sqlite3_stmt *stmt = cached->second;
+      d_stmtcacheindex.erase(it); // (key points into list element, erase first)
+      d_stmtcache.erase(cached);
+      return stmt;
+    }
+    ++d_stmtcache_misses;
+  }
+
+  sqlite3_stmt *stmt = nullptr;
+  if (sqlite3_prepare_v2(d_db, q.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+  {
+    sqlite3_finalize(stmt);
+    return nullptr;
+  }
+  return stmt;
+}
+
+inline void SqliteDB::releaseStatement(std::string const &q, sqlite3_stmt *stmt) const
+{
+  if (!stmt)
+    return;
+
+  sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+
+  std::lock_guard<std::mutex> lock(d_stmtcachemutex);
+  if (d_stmtcacheindex.find(q) != d_stmtcacheindex.end()) [[unlikely]] // was prepared again in a nested exec
+  {
+    sqlite3_finalize(stmt);
+    return;
+  }
+
+  d_stmtcache.emplace_front(q, stmt);
+  d_stmtcacheindex.emplace(d_stmtcache.front().first, d_stmtcache.begin());
+
+  if (d_stmtcache.size() > s_stmtcache_size)
+  {
+    d_stmtcacheindex.erase(d_stmtcache.back().first);
+    sqlite3_finalize(d_stmtcache.back().second);
+    d_stmtcache.pop_back();
+  }
+}
+
+inline void SqliteDB::clearStatementCache() const
+{
+  std::lock_guard<std::mutex> lock(d_stmtcachemutex);
+  d_stmtcacheindex.clear();
+  for (auto const &c : d_stmtcache)
+    sqlite3_finalize(c.second);
+  d_stmtcache.clear();
+}
+
+inline SqliteDB::QueryResults::QueryResults()
+  :
+  d_rows(0),
+  d_fillcolumn(0),
+  d_blobchunk_used(s_blobchunk_size)
+{}
+
 inline void SqliteDB::QueryResults::emplaceHeader(std::string &&h)
 {
+  d_headerindex.emplace(h, d_headers.size());
   d_headers.emplace_back(h);
 }
 
@@ -610,28 +1017,150 @@ inline std::vector<std::string> const &SqliteDB::QueryResults::headers() const
 
 inline bool SqliteDB::QueryResults::hasColumn(std::string const &h) const
 {
-  return bepaald::contains(d_headers, h);
+  return d_headerindex.find(h) != d_headerindex.end();
+}
+
+// values are added row by row, left to right
+inline void SqliteDB::QueryResults::emplaceCell(size_t row, Cell const &cell)
+{
+  if (row >= d_rows)
+  {
+    d_rows = row + 1;
+    d_fillcolumn = 0;
+  }
+  if (d_fillcolumn >= d_columns.size())
+    d_columns.resize(d_fillcolumn + 1);
+  d_columns[d_fillcolumn++].push_back(cell);
+}
+
+inline void SqliteDB::QueryResults::emplaceNull(size_t row)
+{
+  Cell cell;
+  cell.integer = 0;
+  cell.size = 0;
+  cell.type = CellType::NULLVALUE;
+  emplaceCell(row, cell);
+}
+
+inline void SqliteDB::QueryResults::emplaceInteger(size_t row, long long int value)
+{
+  Cell cell;
+  cell.integer = value;
+  cell.size = 0;
+  cell.type = CellType::INTEGER;
+  emplaceCell(row, cell);
+}
+
+inline void SqliteDB::QueryResults::emplaceReal(size_t row, double value)
+{
+  Cell cell;
+  cell.real = value;
+  cell.size = 0;
+  cell.type = CellType::REAL;
+  emplaceCell(row, cell);
+}
+
+inline void SqliteDB::QueryResults::emplaceText(size_t row, char const *text, size_t size)
+{
+  Cell cell;
+  cell.textoffset = d_textarena.size();
+  cell.size = size;
+  cell.type = CellType::TEXT;
+  d_textarena.append(text, size);
+  emplaceCell(row, cell);
+}
+
+inline void SqliteDB::QueryResults::emplaceBlob(size_t row, void const *data, size_t size)
+{
+  // does not fit, start new chunk (large blobs get their own). Also when there is no chunk yet, even
+  // an empty blob needs one to refer to
+  if (d_blobchunks.empty() || size > s_blobchunk_size - d_blobchunk_used)
+  {
+    d_blobchunks.emplace_back(new unsigned char[std::max(static_cast<size_t>(s_blobchunk_size), size)]);
+    d_blobchunk_used = 0;
+  }
+
+  Cell cell;
+  cell.blob.chunk = d_blobchunks.size() - 1;
+  cell.blob.offset = d_blobchunk_used;
+  cell.size = size;
+  cell.type = CellType::BLOB;
+  if (size)
+    std::memcpy(d_blobchunks.back().get() + d_blobchunk_used, data, size);
+  d_blobchunk_used = (size > s_blobchunk_size) ? s_blobchunk_size : d_blobchunk_used + size;
+  emplaceCell(row, cell);
 }
 
 inline void SqliteDB::QueryResults::emplaceValue(size_t row, std::any &&a)
 {
-  if (d_values.size() < row + 1)
-    d_values.resize(row + 1);
+  if (a.type() == typeid(std::nullptr_t))
+    emplaceNull(row);
+  else if (a.type() == typeid(long long int))
+    emplaceInteger(row, std::any_cast<long long int>(a));
+  else if (a.type() == typeid(double))
+    emplaceReal(row, std::any_cast<double>(a));
+  else if (a.type() == typeid(std::string))
+  {
+    std::string const &str = std::any_cast<std::string const &>(a);
+    emplaceText(row, str.data(), str.size());
+  }
+  else if (a.type() == typeid(std::pair<std::shared_ptr<unsigned char []>, size_t>))
+  {
+    auto const &blob = std::any_cast<std::pair<std::shared_ptr<unsigned char []>, size_t> const &>(a);
+    emplaceBlob(row, blob.first.get(), blob.second);
+  }
+  else
+  {
+    Cell cell;
+    cell.otheridx = d_others.size();
+    cell.size = 0;
+    cell.type = CellType::OTHER;
+    d_others.emplace_back(std::move(a));
+    emplaceCell(row, cell);
+  }
+}
 
-  d_values[row].emplace_back(a);
+// shares ownership of the arena chunk holding the data
+inline std::pair<std::shared_ptr<unsigned char []>, size_t> SqliteDB::QueryResults::blobValue(Cell const &cell) const
+{
+  return {std::shared_ptr<unsigned char []>(d_blobchunks[cell.blob.chunk], d_blobchunks[cell.blob.chunk].get() + cell.blob.offset),
+          cell.size};
 }
 
-inline std::any const &SqliteDB::QueryResults::value(size_t row, size_t idx) const
+inline std::any SqliteDB::QueryResults::value(size_t row, size_t idx) const
 {
-  return d_values[row][idx];
+  Cell const &cell = d_columns[idx][row];
+  switch (cell.type)
+  {
+    case CellType::INTEGER:
+      return cell.integer;
+    case CellType::REAL:
+      return cell.real;
+    case CellType::TEXT:
+      return std::string(d_textarena.data() + cell.textoffset, cell.size);
+    case CellType::BLOB:
+      return blobValue(cell);
+    case CellType::OTHER:
+      return d_others[cell.otheridx];
+    case CellType::NULLVALUE:
+    default:
+      return nullptr;
+  }
 }
 
 inline int SqliteDB::QueryResults::idxOfHeader(std::string const &header) const
 {
+  auto it = d_headerindex.find(header);
+  if (it != d_headerindex.end()) [[likely]]
+    return it->second;
+  return -1;
+}
+
+inline void SqliteDB::QueryResults::rebuildHeaderIndex()
+{
+  d_headerindex.clear();
   for (uint i = 0; i < d_headers.size(); ++i)
-    if (d_headers[i] == header)
-      return i;
-  [[unlikely]] return -1;
+    d_headerindex.emplace(d_headers[i], i);
 }
 
 inline std::any SqliteDB::QueryResults::value(size_t row, std::string const &header) const
@@ -643,7 +1172,7 @@ inline std::any SqliteDB::QueryResults::value(size_t row, std::string const &hea
               << ": Column `" << header << "' not found in query results" << std::endl;
     return std::any{nullptr};
   }
-  return d_values[row][i];
+  return value(row, i);
 }
 
 template <typename T>
@@ -657,13 +1186,13 @@ inline T SqliteDB::QueryResults::getValueAs(size_t row, std::string const &heade
     return T{};
   }
 
-  if (d_values[row][i].type() != typeid(T)) [[unlikely]]
+  if (!valueHasType<T>(row, i)) [[unlikely]]
   {
     std::cout << "Getting value of field '" << header << "' (idx " << i << "). Value as string: " << valueAsString(row, i) << std::endl;
-    std::cout << "Type: " << d_values[row][i].type().name() << " Requested type: " << typeid(T).name() << std::endl;
+    std::cout << "Type: " << value(row, i).type().name() << " Requested type: " << typeid(T).name() << std::endl;
     //return T{};
   }
-  return std::any_cast<T>(d_values[row][i]);
+  return getValueAs<T>(row, i);
 }
 
 template <typename T>
@@ -676,13 +1205,25 @@ inline bool SqliteDB::QueryResults::valueHasType(size_t row, std::string const &
               << ": Column `" << header << "' not found in query results" << std::endl;
     return false;
   }
-  return (d_values[row][i].type() == typeid(T));
+  return valueHasType<T>(row, i);
 }
 
 template <typename T>
 inline bool SqliteDB::QueryResults::valueHasType(size_t row, size_t idx) const
 {
-  return (d_values[row][idx].type() == typeid(T));
+  Cell const &cell = d_columns[idx][row];
+  if constexpr (std::is_same_v<T, long long int>)
+    return cell.type == CellType::INTEGER;
+  else if constexpr (std::is_same_v<T, double>)
+    return cell.type == CellType::REAL;
+  else if constexpr (std::is_same_v<T, std::string>)
+    return cell.type == CellType::TEXT;
+  else if constexpr (std::is_same_v<T, std::nullptr_t>)
+    return cell.type == CellType::NULLVALUE;
+  else if constexpr (std::is_same_v<T, std::pair<std::shared_ptr<unsigned char []>, size_t>>)
+    return cell.type == CellType::BLOB;
+  else
+    return cell.type == CellType::OTHER && d_others[cell.otheridx].type() == typeid(T);
 }
 
 inline bool SqliteDB::QueryResults::isNull(size_t row, size_t idx) const
@@ -695,20 +1236,52 @@ inline bool SqliteDB::QueryResults::isNull(size_t row, std::string const &header
   return valueHasType<std::nullptr_t>(row, header);
 }
 
+// like std::any_cast, throws std::bad_any_cast on type mismatch
 template <typename T>
 inline T SqliteDB::QueryResults::getValueAs(size_t row, size_t idx) const
 {
-  return std::any_cast<T>(d_values[row][idx]);
+  Cell const &cell = d_columns[idx][row];
+  if constexpr (std::is_same_v<T, long long int>)
+  {
+    if (cell.type == CellType::INTEGER) [[likely]]
+      return cell.integer;
+  }
+  else if constexpr (std::is_same_v<T, double>)
+  {
+    if (cell.type == CellType::REAL) [[likely]]
+      return cell.real;
+  }
+  else if constexpr (std::is_same_v<T, std::string>)
+  {
+    if (cell.type == CellType::TEXT) [[likely]]
+      return std::string(d_textarena.data() + cell.textoffset, cell.size);
+  }
+  else if constexpr (std::is_same_v<T, std::nullptr_t>)
+  {
+    if (cell.type == CellType::NULLVALUE) [[likely]]
+      return nullptr;
+  }
+  else if constexpr (std::is_same_v<T, std::pair<std::shared_ptr<unsigned char []>, size_t>>)
+  {
+    if (cell.type == CellType::BLOB) [[likely]]
+      return blobValue(cell);
+  }
+  else
+  {
+    if (cell.type == CellType::OTHER) [[likely]]
+      return std::any_cast<T>(d_others[cell.otheridx]);
+  }
+  return std::any_cast<T>(value(row, idx));
 }
 
 inline bool SqliteDB::QueryResults::empty() const
 {
-  return d_values.empty();
+  return d_rows == 0;
 }
 
 inline size_t SqliteDB::QueryResults::rows() const
 {
-  return d_values.size();
+  return d_rows;
 }
 
 inline size_t SqliteDB::QueryResults::columns() const
@@ -719,7 +1292,27 @@ inline size_t SqliteDB::QueryResults::columns() const
 inline void SqliteDB::QueryResults::clear()
 {
   d_headers.clear();
-  d_values.clear();
+  d_headerindex.clear();
+  d_columns.clear();
+  d_rows = 0;
+  d_fillcolumn = 0;
+  d_textarena.clear();
+  d_blobchunks.clear();
+  d_blobchunk_used = s_blobchunk_size;
+  d_others.clear();
+}
+
+// like clear(), but keeps the headers and allocated column storage
+inline void SqliteDB::QueryResults::clearValues()
+{
+  for (auto &c : d_columns)
+    c.clear();
+  d_rows = 0;
+  d_fillcolumn = 0;
+  d_textarena.clear();
+  d_blobchunks.clear();
+  d_blobchunk_used = s_blobchunk_size;
+  d_others.clear();
 }
 
 inline std::string SqliteDB::QueryResults::operator()(size_t row, std::string const &header) const
@@ -735,17 +1328,21 @@ inline std::string SqliteDB::QueryResults::operator()(std::string const &header)
 template <typename T>
 inline bool SqliteDB::QueryResults::contains(T const &value) const
 {
-  for (uint i = 0; i < d_values.size(); ++i)
-    for (uint j = 0; j < d_values[i].size(); ++j)
-      if (d_values[i][j].type() == typeid(T))
-        if (std::any_cast<T>(d_values[i][j]) == value)
+  for (uint j = 0; j < d_columns.size(); ++j)
+    for (uint i = 0; i < d_columns[j].size(); ++i)
+      if (valueHasType<T>(i, j))
+        if (getValueAs<T>(i, j) == value)
           return true;
   return false;
 }
 
-inline std::vector<std::any> const &SqliteDB::QueryResults::row(size_t row) const
+inline std::vector<std::any> SqliteDB::QueryResults::row(size_t row) const
 {
-  return d_values[row];
+  std::vector<std::any> ret;
+  ret.reserve(d_columns.size());
+  for (uint j = 0; j < d_columns.size(); ++j)
+    ret.emplace_back(value(row, j));
+  return ret;
 }
 
 bool SqliteDB::QueryResults::useEscapeCodes() const
@@ -779,12 +1376,16 @@ inline uint64_t SqliteDB::QueryResults::charCount(std::string const &utf8) const
   return ret;
 }
 
+// the row's text or blob data is not released from the arena until clear()
 inline bool SqliteDB::QueryResults::removeRow(uint idx)
 {
-  if (idx >= d_values.size())
+  if (idx >= d_rows)
     return false;
 
-  d_values.erase(d_values.begin() + idx);
+  for (auto &c : d_columns)
+    if (idx < c.size())
+      c.erase(c.begin() + idx);
+  --d_rows;
   return true;
 }
 
@@ -792,7 +1393,9 @@ inline SqliteDB::QueryResults SqliteDB::QueryResults::getRow(uint idx)
 {
   QueryResults tmp;
   tmp.d_headers = d_headers;
-  tmp.d_values.push_back(d_values[idx]);
+  tmp.d_headerindex = d_headerindex;
+  for (uint j = 0; j < d_columns.size(); ++j)
+    tmp.emplaceValue(0, value(idx, j));
   return tmp;
 }
 
@@ -905,4 +1508,29 @@ inline void SqliteDB::token(sqlite3_context *context, int argc, sqlite3_value **
   }
   sqlite3_result_null(context);
 }
+inline SqliteDB::ParameterView SqliteDB::ParameterView::null() // static
+{
+  return ParameterView{Type::NULLVALUE, 0, 0, nullptr, 0};
+}
+
+inline SqliteDB::ParameterView SqliteDB::ParameterView::integer(long long int value) // static
+{
+  return ParameterView{Type::INTEGER, value, 0, nullptr, 0};
+}
+
+inline SqliteDB::ParameterView SqliteDB::ParameterView::real(double value) // static
+{
+  return ParameterView{Type::REAL, 0, value, nullptr, 0};
+}
+
+inline SqliteDB::ParameterView SqliteDB::ParameterView::text(unsigned char const *data, uint64_t size) // static
+{
+  return ParameterView{Type::TEXT, 0, 0, data, size};
+}
+
+inline SqliteDB::ParameterView SqliteDB::ParameterView::blob(unsigned char const *data, uint64_t size) // static
+{
+  return ParameterView{Type::BLOB, 0, 0, data, size};
+}
+
 #endif
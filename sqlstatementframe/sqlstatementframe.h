@@ -25,8 +25,10 @@
 #include <memory>
 #include <vector>
 #include <any>
+#include <string_view>
 
 #include "../backupframe/backupframe.h"
+#include "../sqlitedb/sqlitedb.h"
 
 struct Period final : std::numpunct<char>
 {
@@ -55,6 +57,8 @@ class SqlStatementFrame : public BackupFrame
   static Registrar s_registrar;
 
   std::vector<std::tuple<unsigned int, unsigned char *, uint64_t>> d_parameterdata; // PARAMETER_FIELD, bytes, size
+  std::unique_ptr<unsigned char[]> d_parameterarena; // the varint parameters, other parameters point into d_arena
+  size_t d_parameterarena_size;
   std::string d_statement;
 
  public:
@@ -83,7 +87,9 @@ class SqlStatementFrame : public BackupFrame
   inline void addParameterField(PARAMETER_FIELD field, std::string const &val);
 
   inline std::string bindStatement() const;
+  inline std::string_view statementView() const;
   inline std::vector<std::any> parameters() const;
+  inline void parameterViews(std::vector<SqliteDB::ParameterView> *views) const;
 
   // inline void setParameter(uint idx, unsigned char *data, uint32_t length);
   // inline void getParameter(uint idx) const;
@@ -95,23 +101,50 @@ class SqlStatementFrame : public BackupFrame
  private:
   void buildStatement();
   inline uint64_t dataSize() const;
+  inline void deleteParameterData(unsigned char *data) const;
+  inline static double bytesToDouble(unsigned char const *data);
 };
 
 inline SqlStatementFrame::SqlStatementFrame()
   :
-  BackupFrame(-1)
+  BackupFrame(-1),
+  d_parameterarena_size(0)
 {}
 
 inline SqlStatementFrame::SqlStatementFrame(unsigned char *data, size_t length, uint64_t count)
   :
-  BackupFrame(data, length, count)
+  BackupFrame(data, length, count),
+  d_parameterarena_size(0)
 {
   //std::cout << "CREATING SQLSTATEMENTFRAME" << std::endl;
+  if (!d_ok) [[unlikely]]
+    return;
+
+  // the parameter fields are parsed in place (they are in d_arena already), only
+  // the varints need separate storage
+  size_t fields = 0;
+  size_t varints = 0;
+  for (auto const &p : d_framedata)
+    if (std::get<0>(p) == FIELD::PARAMETERS)
+      if (!scanFields(std::get<1>(p), std::get<2>(p), &fields, &varints)) [[unlikely]]
+      {
+        d_ok = false;
+        return;
+      }
+
+  if (varints)
+  {
+    d_parameterarena_size = varints * sizeof(uint64_t);
+    d_parameterarena.reset(new unsigned char[d_parameterarena_size]);
+  }
+  unsigned char *varintdata = d_parameterarena.get();
+  d_parameterdata.reserve(fields);
+
   for (auto const &p : d_framedata)
     if (std::get<0>(p) == FIELD::PARAMETERS)
     {
       //std::cout << "INITIALIZING PARAMETERS: " << std::get<2>(p) << " bytes" << std::endl;
-      if (!init(std::get<1>(p), std::get<2>(p), &d_parameterdata)) [[unlikely]]
+      if (!init(std::get<1>(p), std::get<2>(p), &d_parameterdata, &varintdata)) [[unlikely]]
       {
         d_ok = false;
         break;
@@ -122,9 +155,12 @@ inline SqlStatementFrame::SqlStatementFrame(unsigned char *data, size_t length,
 inline SqlStatementFrame::SqlStatementFrame(SqlStatementFrame &&other)
   :
   BackupFrame(std::move(other)),
-  d_parameterdata(std::move(other.d_parameterdata))
+  d_parameterdata(std::move(other.d_parameterdata)),
+  d_parameterarena(std::move(other.d_parameterarena)),
+  d_parameterarena_size(other.d_parameterarena_size)
 {
   other.d_parameterdata.clear();
+  other.d_parameterarena_size = 0;
 }
 
 inline SqlStatementFrame &SqlStatementFrame::operator=(SqlStatementFrame &&other)
@@ -133,20 +169,24 @@ inline SqlStatementFrame &SqlStatementFrame::operator=(SqlStatementFrame &&other
   {
     // properly delete any data this is holding
     for (uint i = 0; i < d_parameterdata.size(); ++i)
-      if (std::get<1>(d_parameterdata[i]))
-        delete[] std::get<1>(d_parameterdata[i]);
+      deleteParameterData(std::get<1>(d_parameterdata[i]));
     d_parameterdata.clear();
 
     BackupFrame::operator=(std::move(other));
     d_parameterdata = std::move(other.d_parameterdata);
     other.d_parameterdata.clear();
+    d_parameterarena = std::move(other.d_parameterarena);
+    d_parameterarena_size = other.d_parameterarena_size;
+    other.d_parameterarena_size = 0;
   }
   return *this;
 }
 
+// a copy owns all its parameter data individually
 inline SqlStatementFrame::SqlStatementFrame(SqlStatementFrame const &other)
   :
   BackupFrame(other),
+  d_parameterarena_size(0),
   d_statement(other.d_statement)
 {
   for (uint i = 0; i < other.d_parameterdata.size(); ++i)
@@ -185,11 +225,27 @@ inline SqlStatementFrame::~SqlStatementFrame()
 {
   //std::cout << "DESTROYING SQLSTATEMENTFRAME" << std::endl;
   for (uint i = 0; i < d_parameterdata.size(); ++i)
-    if (std::get<1>(d_parameterdata[i]))
-      delete[] std::get<1>(d_parameterdata[i]);
+    deleteParameterData(std::get<1>(d_parameterdata[i]));
   d_parameterdata.clear();
 }
 
+// frees parameter data, unless it lives in d_arena or d_parameterarena
+inline void SqlStatementFrame::deleteParameterData(unsigned char *data) const
+{
+  if (data &&
+      !inBuffer(data, d_arena.get(), d_arena_size) &&
+      !inBuffer(data, d_parameterarena.get(), d_parameterarena_size))
+    delete[] data;
+}
+
+// parameter data is not necessarily aligned
+inline double SqlStatementFrame::bytesToDouble(unsigned char const *data) // static
+{
+  double val;
+  std::memcpy(&val, data, sizeof(val));
+  return val;
+}
+
 inline BackupFrame::FRAMETYPE SqlStatementFrame::frameType() const // virtual override
 {
   return FRAMETYPE::SQLSTATEMENT;
@@ -230,7 +286,7 @@ inline void SqlStatementFrame::printInfo() const
             std::cout << "         - (uint64 parameter): \"" << bytesToUint64(std::get<1>(d_parameterdata[param_ctr]), std::get<2>(d_parameterdata[param_ctr])) << "\"" << std::endl;
             break;
           case PARAMETER_FIELD::DOUBLE:
-            std::cout << "         - (double parameter): \"" << bepaald::toString(*reinterpret_cast<double *>(std::get<1>(d_parameterdata[param_ctr]))) << "\" " << bepaald::bytesToHexString(std::get<1>(d_parameterdata[param_ctr]), std::get<2>(d_parameterdata[param_ctr])) << std::endl;
+            std::cout << "         - (double parameter): \"" << bepaald::toString(bytesToDouble(std::get<1>(d_parameterdata[param_ctr]))) << "\" " << bepaald::bytesToHexString(std::get<1>(d_parameterdata[param_ctr]), std::get<2>(d_parameterdata[param_ctr])) << std::endl;
             break;
           case PARAMETER_FIELD::BLOB:
             std::cout << "         - (binary parameter): \"" << bepaald::bytesToHexString(std::get<1>(d_parameterdata[param_ctr]), std::get<2>(d_parameterdata[param_ctr])) << "\"" << std::endl;
@@ -284,7 +340,7 @@ inline void SqlStatementFrame::printInfo(std::vector<std::string> const &paramet
             break;
           case PARAMETER_FIELD::DOUBLE:
             std::cout << "         - " << parameternames[param_ctr] << " (double parameter): \""
-                      << *reinterpret_cast<double *>(std::get<1>(d_parameterdata[param_ctr]))<< "\" " << bepaald::bytesToHexString(std::get<1>(d_parameterdata[param_ctr]), std::get<2>(d_parameterdata[param_ctr])) << std::endl;
+                      << bytesToDouble(std::get<1>(d_parameterdata[param_ctr]))<< "\" " << bepaald::bytesToHexString(std::get<1>(d_parameterdata[param_ctr]), std::get<2>(d_parameterdata[param_ctr])) << std::endl;
             break;
           case PARAMETER_FIELD::BLOB:
             std::cout << "         - " << parameternames[param_ctr] << " (binary parameter): \""
@@ -574,6 +630,15 @@ inline std::string SqlStatementFrame::bindStatement() const
   return std::string();
 }
 
+// the statement as stored in the frame (with the '?' placeholders), valid as long as this frame is
+inline std::string_view SqlStatementFrame::statementView() const
+{
+  for (auto const &p : d_framedata)
+    if (std::get<0>(p) == FIELD::STATEMENT)
+      return std::string_view(reinterpret_cast<char const *>(std::get<1>(p)), std::get<2>(p));
+  return std::string_view();
+}
+
 inline std::vector<std::any> SqlStatementFrame::parameters() const
 {
   std::vector<std::any> parameters;
@@ -608,7 +673,7 @@ inline std::vector<std::any> SqlStatementFrame::parameters() const
       }
       case PARAMETER_FIELD::DOUBLE:
       {
-        parameters.emplace_back(*reinterpret_cast<double *>(std::get<1>(p)));
+        parameters.emplace_back(bytesToDouble(std::get<1>(p)));
         break;
       }
       case PARAMETER_FIELD::BLOB:
@@ -629,6 +694,37 @@ inline std::vector<std::any> SqlStatementFrame::parameters() const
   return parameters;
 }
 
+/*
+  As parameters(), but refers to the data in this frame instead of copying it. The views
+  are only valid as long as this frame is (and unchanged). 'views' is cleared first, so it
+  can be reused for every frame.
+*/
+inline void SqlStatementFrame::parameterViews(std::vector<SqliteDB::ParameterView> *views) const
+{
+  views->clear();
+  for (auto const &p : d_parameterdata)
+  {
+    switch (std::get<0>(p))
+    {
+      case PARAMETER_FIELD::INT:
+        views->emplace_back(SqliteDB::ParameterView::integer(static_cast<long long int>(bytesToUint64(std::get<1>(p), std::get<2>(p)))));
+        break;
+      case PARAMETER_FIELD::STRING:
+        views->emplace_back(SqliteDB::ParameterView::text(std::get<1>(p), std::get<2>(p)));
+        break;
+      case PARAMETER_FIELD::DOUBLE:
+        views->emplace_back(SqliteDB::ParameterView::real(bytesToDouble(std::get<1>(p))));
+        break;
+      case PARAMETER_FIELD::BLOB:
+        views->emplace_back(SqliteDB::ParameterView::blob(std::get<1>(p), std::get<2>(p)));
+        break;
+      case PARAMETER_FIELD::NULLPARAMETER:
+        views->emplace_back(SqliteDB::ParameterView::null());
+        break;
+    }
+  }
+}
+
 inline bool SqlStatementFrame::validate() const
 {
   if (d_framedata.empty())